@@ -13,11 +13,11 @@ int main()
     constexpr boost::int128::int128_t signed_value {-42};
     std::cout << "Signed value: " << signed_value << std::endl;
 
-    // We can also use <iomanip> to change the output format
+    // We can also use <iomanip> to change the output format, and std::showbase adds the prefix
     constexpr boost::int128::uint128_t unsigned_value {0x1, UINT64_MAX};
     std::cout << "Unsigned value (dec): " << unsigned_value << '\n'
-              << "Unsigned value (hex): " << std::hex << unsigned_value << '\n'             // LCOV_EXCL_LINE
-              << "Unsigned value (oct): " << std::oct << unsigned_value << std::endl;       // LCOV_EXCL_LINE
+              << "Unsigned value (hex): " << std::hex << std::showbase << unsigned_value << '\n'             // LCOV_EXCL_LINE
+              << "Unsigned value (oct): " << std::oct << unsigned_value << std::endl;                         // LCOV_EXCL_LINE
 
     // Hex also can be manipulated to be uppercase
     std::cout << "Upper unsigned value: " << std::hex << std::uppercase << unsigned_value << std::endl;
@@ -25,5 +25,8 @@ int main()
     // And returned to default formating
     std::cout << "Lower unsigned value: " << std::dec << std::nouppercase << unsigned_value << std::endl;
 
+    // Width, fill and alignment apply as they do to the builtin types
+    std::cout << "Padded signed value: [" << std::setw(8) << std::setfill('0') << std::internal << signed_value << ']' << std::endl;
+
     return 0;
 }
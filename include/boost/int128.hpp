@@ -10,5 +10,8 @@
 #include <boost/int128/iostream.hpp>
 #include <boost/int128/literals.hpp>
 #include <boost/int128/numeric.hpp>
+#include <boost/int128/divider.hpp>
+#include <boost/int128/cstdlib.hpp>
+#include <boost/int128/prime.hpp>
 
 #endif // BOOST_INT128_HPP
@@ -9,6 +9,7 @@
 #include <boost/int128/detail/config.hpp>
 #include <boost/int128/detail/clz.hpp>
 #include <boost/int128/detail/ctz.hpp>
+#include <boost/int128/detail/pow10.hpp>
 
 namespace boost {
 namespace int128 {
@@ -196,6 +197,68 @@ BOOST_INT128_EXPORT constexpr uint128_t byteswap(const uint128_t x) noexcept
 
 #endif
 
+// Floor of the base 2 logarithm, or -1 for zero
+
+BOOST_INT128_EXPORT constexpr int ilog2(const uint128_t x) noexcept
+{
+    return bit_width(x) - 1;
+}
+
+// Floor of the base 10 logarithm, or -1 for zero
+
+BOOST_INT128_EXPORT constexpr int ilog10(const uint128_t x) noexcept
+{
+    const auto guess {static_cast<int>(detail::ilog10_guess[countl_zero(x)])};
+    return guess - static_cast<int>(x < detail::pow10_u128[guess]);
+}
+
+// Number of digits of x written in a base from 2 to 36, which is 1 for zero
+
+BOOST_INT128_EXPORT constexpr int num_digits(uint128_t x, const int base = 10) noexcept
+{
+    BOOST_INT128_ASSERT_MSG(base >= 2 && base <= 36, "Base must be between 2 and 36");
+
+    if (x == 0U)
+    {
+        return 1;
+    }
+
+    if (base == 10)
+    {
+        return ilog10(x) + 1;
+    }
+
+    const auto unsigned_base {static_cast<std::uint64_t>(base)};
+
+    if ((unsigned_base & (unsigned_base - 1U)) == 0U)
+    {
+        const auto bits_per_digit {detail::countr_zero(unsigned_base)};
+        return (bit_width(x) + bits_per_digit - 1) / bits_per_digit;
+    }
+
+    // Strip the largest power of the base that fits in a word, then count on 64 bits
+    int digits {1};
+
+    if (x.high != 0U)
+    {
+        const auto chunk {detail::base_chunk_pow[base]};
+        const auto chunk_digits {static_cast<int>(detail::base_chunk_digits[base])};
+
+        while (x.high != 0U)
+        {
+            x /= chunk;
+            digits += chunk_digits;
+        }
+    }
+
+    for (auto low {x.low}; low >= unsigned_base; low /= unsigned_base)
+    {
+        ++digits;
+    }
+
+    return digits;
+}
+
 } // namespace int128
 } // namespace boost
 
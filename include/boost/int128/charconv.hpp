@@ -2,15 +2,20 @@
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
 //
-// This header injects additional functionality into the Boost.Charconv namespace
+// The native to_chars, from_chars and parse_column functions are always available.
+// When Boost.Charconv is present, this header also injects overloads into its namespace.
 // If this library is accepted into boost this functionality could be moved their
 
 #ifndef BOOST_INT128_CHARCONV_HPP
 #define BOOST_INT128_CHARCONV_HPP
 
+#include <boost/int128/int128.hpp>
+#include <boost/int128/detail/mini_to_chars.hpp>
+#include <boost/int128/detail/mini_from_chars.hpp>
+#include <boost/int128/detail/parse_column.hpp>
+
 #if __has_include(<boost/charconv.hpp>)
 
-#include <boost/int128/int128.hpp>
 #include <boost/charconv.hpp>
 #include <boost/core/detail/string_view.hpp>
 
@@ -82,10 +87,6 @@ BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(core::string_view sv,
 } // namespace charconv
 } // namespace boost
 
-#else
-
-#error "This header requires Boost.Charconv to be present"
-
 #endif // __has_include(<boost/charconv.hpp>)
 
 #endif // BOOST_INT128_CHARCONV_HPP
@@ -0,0 +1,197 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_CSTDLIB_HPP
+#define BOOST_INT128_CSTDLIB_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/detail/config.hpp>
+#include <boost/int128/detail/traits.hpp>
+#include <boost/int128/detail/common_div.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <type_traits>
+#include <cstdint>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+// Analogous to std::div_t, but the remainder can be narrower than the quotient
+// since it is always smaller than the divisor
+BOOST_INT128_EXPORT template <typename Quotient, typename Remainder = Quotient>
+struct div_result
+{
+    Quotient quot;
+    Remainder rem;
+};
+
+namespace detail {
+
+template <typename T>
+using narrow_unsigned_divisor_t = std::conditional_t<sizeof(T) <= sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+
+template <typename T>
+using narrow_signed_divisor_t = std::conditional_t<sizeof(T) <= sizeof(std::int32_t), std::int32_t, std::int64_t>;
+
+template <typename T>
+BOOST_INT128_INLINE_CONSTEXPR bool is_narrow_unsigned_divisor_v {is_unsigned_integer_v<T> && sizeof(T) <= sizeof(std::uint64_t)};
+
+template <typename T>
+BOOST_INT128_INLINE_CONSTEXPR bool is_narrow_signed_divisor_v {is_signed_integer_v<T> && sizeof(T) <= sizeof(std::int64_t)};
+
+// Both results of x / y in a single division where y is non-zero and fits in 64 bits
+BOOST_INT128_FORCE_INLINE constexpr uint128_t narrow_divmod(const uint128_t x, const std::uint64_t y, std::uint64_t& remainder) noexcept
+{
+    if (x.high == 0U)
+    {
+        remainder = x.low % y;
+        return uint128_t{0, x.low / y};
+    }
+
+    #if defined(BOOST_INT128_HAS_INT128) && !defined(__s390__) && !defined(__s390x__)
+
+    const auto quotient {static_cast<uint128_t>(static_cast<builtin_u128>(x) / y)};
+
+    // The remainder is less than y, so only the low word of the product is needed
+    remainder = x.low - quotient.low * y;
+
+    return quotient;
+
+    #else
+
+    uint128_t quotient {};
+    uint128_t wide_remainder {};
+    one_word_div(x, y, quotient, wide_remainder);
+
+    remainder = wide_remainder.low;
+
+    return quotient;
+
+    #endif
+}
+
+BOOST_INT128_FORCE_INLINE constexpr uint128_t narrow_divmod(const uint128_t x, const std::uint32_t y, std::uint32_t& remainder) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128) && !defined(__s390__) && !defined(__s390x__)
+
+    std::uint64_t wide_remainder {};
+    const auto quotient {narrow_divmod(x, static_cast<std::uint64_t>(y), wide_remainder)};
+
+    #else
+
+    if (x.high == 0U)
+    {
+        remainder = static_cast<std::uint32_t>(x.low % y);
+        return uint128_t{0, x.low / y};
+    }
+
+    uint128_t quotient {};
+    uint128_t wide_remainder {};
+    half_word_div(x, y, quotient, wide_remainder);
+
+    #endif
+
+    remainder = static_cast<std::uint32_t>(wide_remainder);
+
+    return quotient;
+}
+
+} // namespace detail
+
+// Computes both x / y and x % y with a single division.
+// Division by zero returns zero for both results to match the operators.
+
+BOOST_INT128_EXPORT constexpr div_result<uint128_t> div(const uint128_t x, const uint128_t y) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(y == 0U))
+    {
+        return {uint128_t{0}, uint128_t{0}};
+    }
+    else if (x < y)
+    {
+        return {uint128_t{0}, x};
+    }
+    #if defined(BOOST_INT128_HAS_INT128) && !defined(__s390__) && !defined(__s390x__)
+    else
+    {
+        const auto quotient {static_cast<uint128_t>(static_cast<detail::builtin_u128>(x) / static_cast<detail::builtin_u128>(y))};
+        return {quotient, x - quotient * y};
+    }
+    #else
+    else if (y.high != 0U)
+    {
+        uint128_t remainder {};
+        const auto quotient {detail::knuth_div(x, y, remainder)};
+        return {quotient, remainder};
+    }
+    else
+    {
+        std::uint64_t remainder {};
+        const auto quotient {detail::narrow_divmod(x, y.low, remainder)};
+        return {quotient, uint128_t{remainder}};
+    }
+    #endif
+}
+
+// The remainder of a narrow divisor is returned as the matching narrow type
+
+BOOST_INT128_EXPORT template <typename UnsignedInteger, std::enable_if_t<detail::is_narrow_unsigned_divisor_v<UnsignedInteger>, bool> = true>
+constexpr div_result<uint128_t, detail::narrow_unsigned_divisor_t<UnsignedInteger>> div(const uint128_t x, const UnsignedInteger y) noexcept
+{
+    using remainder_type = detail::narrow_unsigned_divisor_t<UnsignedInteger>;
+
+    if (BOOST_INT128_UNLIKELY(y == 0U))
+    {
+        return {uint128_t{0}, remainder_type{0}};
+    }
+
+    remainder_type remainder {};
+    const auto quotient {detail::narrow_divmod(x, static_cast<remainder_type>(y), remainder)};
+
+    return {quotient, remainder};
+}
+
+// Signed division truncates towards zero, and the remainder has the sign of the dividend.
+// Working with the magnitudes keeps min() well-defined for every divisor except -1,
+// where the quotient overflows and wraps to min() like the built-in types.
+
+BOOST_INT128_EXPORT constexpr div_result<int128_t> div(const int128_t x, const int128_t y) noexcept
+{
+    const auto abs_x {x < 0 ? -static_cast<uint128_t>(x) : static_cast<uint128_t>(x)};
+    const auto abs_y {y < 0 ? -static_cast<uint128_t>(y) : static_cast<uint128_t>(y)};
+
+    const auto unsigned_result {div(abs_x, abs_y)};
+
+    const auto quotient {(x < 0) != (y < 0) ? -unsigned_result.quot : unsigned_result.quot};
+    const auto remainder {x < 0 ? -unsigned_result.rem : unsigned_result.rem};
+
+    return {static_cast<int128_t>(quotient), static_cast<int128_t>(remainder)};
+}
+
+BOOST_INT128_EXPORT template <typename SignedInteger, std::enable_if_t<detail::is_narrow_signed_divisor_v<SignedInteger>, bool> = true>
+constexpr div_result<int128_t, detail::narrow_signed_divisor_t<SignedInteger>> div(const int128_t x, const SignedInteger y) noexcept
+{
+    using remainder_type = detail::narrow_signed_divisor_t<SignedInteger>;
+    using unsigned_remainder_type = std::make_unsigned_t<remainder_type>;
+
+    const auto abs_x {x < 0 ? -static_cast<uint128_t>(x) : static_cast<uint128_t>(x)};
+    const auto unsigned_y {static_cast<unsigned_remainder_type>(static_cast<remainder_type>(y))};
+    const auto abs_y {static_cast<unsigned_remainder_type>(y < 0 ? unsigned_remainder_type{0} - unsigned_y : unsigned_y)};
+
+    const auto unsigned_result {div(abs_x, abs_y)};
+
+    // The magnitude of the remainder is less than |y|, so it always fits in the narrow type
+    const auto quotient {(x < 0) != (y < 0) ? -unsigned_result.quot : unsigned_result.quot};
+    const auto remainder {static_cast<remainder_type>(x < 0 ? unsigned_remainder_type{0} - unsigned_result.rem : unsigned_result.rem)};
+
+    return {static_cast<int128_t>(quotient), remainder};
+}
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_CSTDLIB_HPP
@@ -7,6 +7,7 @@
 
 #include <boost/int128/detail/config.hpp>
 #include <boost/int128/detail/clz.hpp>
+#include <boost/int128/detail/common_mul.hpp>
 
 #ifndef BOOST_INT128_BUILD_MODULE
 
@@ -72,6 +73,110 @@ namespace impl {
 #  pragma warning(disable : 4127) // Pre c++17 the if constexpr remainder part will hit this
 #endif
 
+// See: N. Moller and T. Granlund, Improved division by invariant integers, IEEE Transactions on Computers, 2011
+// These kernels work on 64-bit limbs instead of the 32-bit words used by knuth_divide,
+// and replace hardware division with multiplication by a precomputed reciprocal
+
+// floor((2^19 - 3 * 2^8) / d9) for d9 in [256, 512)
+static constexpr std::uint16_t reciprocal_table[256] = {
+    UINT16_C(2045), UINT16_C(2037), UINT16_C(2029), UINT16_C(2021), UINT16_C(2013), UINT16_C(2005), UINT16_C(1998), UINT16_C(1990), UINT16_C(1983), UINT16_C(1975), UINT16_C(1968), UINT16_C(1960), UINT16_C(1953), UINT16_C(1946), UINT16_C(1938), UINT16_C(1931),
+    UINT16_C(1924), UINT16_C(1917), UINT16_C(1910), UINT16_C(1903), UINT16_C(1896), UINT16_C(1889), UINT16_C(1883), UINT16_C(1876), UINT16_C(1869), UINT16_C(1863), UINT16_C(1856), UINT16_C(1849), UINT16_C(1843), UINT16_C(1836), UINT16_C(1830), UINT16_C(1824),
+    UINT16_C(1817), UINT16_C(1811), UINT16_C(1805), UINT16_C(1799), UINT16_C(1792), UINT16_C(1786), UINT16_C(1780), UINT16_C(1774), UINT16_C(1768), UINT16_C(1762), UINT16_C(1756), UINT16_C(1750), UINT16_C(1745), UINT16_C(1739), UINT16_C(1733), UINT16_C(1727),
+    UINT16_C(1722), UINT16_C(1716), UINT16_C(1710), UINT16_C(1705), UINT16_C(1699), UINT16_C(1694), UINT16_C(1688), UINT16_C(1683), UINT16_C(1677), UINT16_C(1672), UINT16_C(1667), UINT16_C(1661), UINT16_C(1656), UINT16_C(1651), UINT16_C(1646), UINT16_C(1641),
+    UINT16_C(1636), UINT16_C(1630), UINT16_C(1625), UINT16_C(1620), UINT16_C(1615), UINT16_C(1610), UINT16_C(1605), UINT16_C(1600), UINT16_C(1596), UINT16_C(1591), UINT16_C(1586), UINT16_C(1581), UINT16_C(1576), UINT16_C(1572), UINT16_C(1567), UINT16_C(1562),
+    UINT16_C(1558), UINT16_C(1553), UINT16_C(1548), UINT16_C(1544), UINT16_C(1539), UINT16_C(1535), UINT16_C(1530), UINT16_C(1526), UINT16_C(1521), UINT16_C(1517), UINT16_C(1513), UINT16_C(1508), UINT16_C(1504), UINT16_C(1500), UINT16_C(1495), UINT16_C(1491),
+    UINT16_C(1487), UINT16_C(1483), UINT16_C(1478), UINT16_C(1474), UINT16_C(1470), UINT16_C(1466), UINT16_C(1462), UINT16_C(1458), UINT16_C(1454), UINT16_C(1450), UINT16_C(1446), UINT16_C(1442), UINT16_C(1438), UINT16_C(1434), UINT16_C(1430), UINT16_C(1426),
+    UINT16_C(1422), UINT16_C(1418), UINT16_C(1414), UINT16_C(1411), UINT16_C(1407), UINT16_C(1403), UINT16_C(1399), UINT16_C(1396), UINT16_C(1392), UINT16_C(1388), UINT16_C(1384), UINT16_C(1381), UINT16_C(1377), UINT16_C(1374), UINT16_C(1370), UINT16_C(1366),
+    UINT16_C(1363), UINT16_C(1359), UINT16_C(1356), UINT16_C(1352), UINT16_C(1349), UINT16_C(1345), UINT16_C(1342), UINT16_C(1338), UINT16_C(1335), UINT16_C(1332), UINT16_C(1328), UINT16_C(1325), UINT16_C(1322), UINT16_C(1318), UINT16_C(1315), UINT16_C(1312),
+    UINT16_C(1308), UINT16_C(1305), UINT16_C(1302), UINT16_C(1299), UINT16_C(1295), UINT16_C(1292), UINT16_C(1289), UINT16_C(1286), UINT16_C(1283), UINT16_C(1280), UINT16_C(1276), UINT16_C(1273), UINT16_C(1270), UINT16_C(1267), UINT16_C(1264), UINT16_C(1261),
+    UINT16_C(1258), UINT16_C(1255), UINT16_C(1252), UINT16_C(1249), UINT16_C(1246), UINT16_C(1243), UINT16_C(1240), UINT16_C(1237), UINT16_C(1234), UINT16_C(1231), UINT16_C(1228), UINT16_C(1226), UINT16_C(1223), UINT16_C(1220), UINT16_C(1217), UINT16_C(1214),
+    UINT16_C(1211), UINT16_C(1209), UINT16_C(1206), UINT16_C(1203), UINT16_C(1200), UINT16_C(1197), UINT16_C(1195), UINT16_C(1192), UINT16_C(1189), UINT16_C(1187), UINT16_C(1184), UINT16_C(1181), UINT16_C(1179), UINT16_C(1176), UINT16_C(1173), UINT16_C(1171),
+    UINT16_C(1168), UINT16_C(1165), UINT16_C(1163), UINT16_C(1160), UINT16_C(1158), UINT16_C(1155), UINT16_C(1153), UINT16_C(1150), UINT16_C(1148), UINT16_C(1145), UINT16_C(1143), UINT16_C(1140), UINT16_C(1138), UINT16_C(1135), UINT16_C(1133), UINT16_C(1130),
+    UINT16_C(1128), UINT16_C(1125), UINT16_C(1123), UINT16_C(1121), UINT16_C(1118), UINT16_C(1116), UINT16_C(1113), UINT16_C(1111), UINT16_C(1109), UINT16_C(1106), UINT16_C(1104), UINT16_C(1102), UINT16_C(1099), UINT16_C(1097), UINT16_C(1095), UINT16_C(1092),
+    UINT16_C(1090), UINT16_C(1088), UINT16_C(1086), UINT16_C(1083), UINT16_C(1081), UINT16_C(1079), UINT16_C(1077), UINT16_C(1074), UINT16_C(1072), UINT16_C(1070), UINT16_C(1068), UINT16_C(1066), UINT16_C(1064), UINT16_C(1061), UINT16_C(1059), UINT16_C(1057),
+    UINT16_C(1055), UINT16_C(1053), UINT16_C(1051), UINT16_C(1049), UINT16_C(1047), UINT16_C(1044), UINT16_C(1042), UINT16_C(1040), UINT16_C(1038), UINT16_C(1036), UINT16_C(1034), UINT16_C(1032), UINT16_C(1030), UINT16_C(1028), UINT16_C(1026), UINT16_C(1024)
+};
+
+// Algorithm 2: returns floor((2^128 - 1) / d) - 2^64 for a normalized d (i.e. the most significant bit is set)
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t reciprocal_word(const std::uint64_t d) noexcept
+{
+    const auto d0 {d & 1U};
+    const auto d9 {d >> 55U};
+    const auto d40 {(d >> 24U) + 1U};
+    const auto d63 {(d >> 1U) + d0};
+
+    const std::uint64_t v0 {reciprocal_table[d9 - 256U]};
+    const auto v1 {(v0 << 11U) - ((v0 * v0 * d40) >> 40U) - 1U};
+    const auto v2 {(v1 << 13U) + ((v1 * ((UINT64_C(1) << 60U) - v1 * d40)) >> 47U)};
+
+    const auto e {((v2 >> 1U) & (UINT64_C(0) - d0)) - v2 * d63};
+    std::uint64_t ve_high {};
+    static_cast<void>(umul64(v2, e, ve_high));
+    const auto v3 {(ve_high >> 1U) + (v2 << 31U)};
+
+    std::uint64_t p_high {};
+    auto p_low {umul64(v3, d, p_high)};
+    p_low += d;
+    p_high += static_cast<std::uint64_t>(p_low < d);
+
+    return v3 - p_high - d;
+}
+
+// Algorithm 4 (udiv_qrnnd_preinv): divides (u1, u0) by the normalized d where u1 < d and v = reciprocal_word(d)
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t div_2by1(const std::uint64_t u1, const std::uint64_t u0,
+                                                           const std::uint64_t d, const std::uint64_t v,
+                                                           std::uint64_t& remainder) noexcept
+{
+    std::uint64_t q1 {};
+    auto q0 {umul64(v, u1, q1)};
+    q0 += u0;
+    q1 += u1 + 1U + static_cast<std::uint64_t>(q0 < u0);
+
+    // This adjustment is taken about half the time, so use masks instead of an unpredictable branch
+    auto r {u0 - q1 * d};
+    const auto mask {UINT64_C(0) - static_cast<std::uint64_t>(r > q0)};
+    q1 += mask;
+    r += mask & d;
+    if (BOOST_INT128_UNLIKELY(r >= d))
+    {
+        ++q1;       // LCOV_EXCL_LINE
+        r -= d;     // LCOV_EXCL_LINE
+    }
+
+    remainder = r;
+    return q1;
+}
+
+// 128 by 64-bit division using two 2-by-1 steps
+template <typename T>
+BOOST_INT128_FORCE_INLINE constexpr T mg_div_one_limb(const T& dividend, const std::uint64_t divisor, std::uint64_t& remainder) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    BOOST_INT128_ASSUME(divisor != 0U); // LCOV_EXCL_LINE
+
+    const auto dividend_high {static_cast<std::uint64_t>(dividend.high)};
+
+    const auto s {countl_zero(divisor)};
+    const auto complement_s {64 - s};
+
+    const auto d {divisor << s};
+    const auto u2 {s == 0 ? UINT64_C(0) : dividend_high >> complement_s};
+    const auto u1 {s == 0 ? dividend_high : (dividend_high << s) | (dividend.low >> complement_s)};
+    const auto u0 {dividend.low << s};
+
+    const auto v {reciprocal_word(d)};
+
+    std::uint64_t r {};
+    const auto q1 {div_2by1(u2, u1, d, v, r)};
+    const auto q0 {div_2by1(r, u0, d, v, r)};
+
+    remainder = r >> s;
+
+    return T{static_cast<high_word_type>(q1), q0};
+}
+
+
 template <std::size_t v_size>
 BOOST_INT128_FORCE_INLINE constexpr void unpack_v(std::uint32_t (&vn)[4], const std::uint32_t (&v)[v_size],
     const bool needs_shift, const int s, const int complement_s, const std::integral_constant<std::size_t, 2>&) noexcept
@@ -90,6 +195,28 @@ BOOST_INT128_FORCE_INLINE constexpr void unpack_v(std::uint32_t (&vn)[4], const
     vn[0] = needs_shift ? (v[0] << s) : v[0];
 }
 
+BOOST_INT128_FORCE_INLINE constexpr void unpack_u(std::uint32_t (&un)[5], const std::uint32_t (&u)[4],
+    const bool needs_shift, const int s, const int complement_s, const std::integral_constant<std::size_t, 4>&) noexcept
+{
+    un[4] = needs_shift ? (u[3] >> complement_s) : 0;
+    un[3] = needs_shift ? ((u[3] << s) | (u[2] >> complement_s)) : u[3];
+    un[2] = needs_shift ? ((u[2] << s) | (u[1] >> complement_s)) : u[2];
+    un[1] = needs_shift ? ((u[1] << s) | (u[0] >> complement_s)) : u[1];
+    un[0] = needs_shift ? (u[0] << s) : u[0];
+}
+
+// Used for 256-bit dividends
+BOOST_INT128_FORCE_INLINE constexpr void unpack_u(std::uint32_t (&un)[9], const std::uint32_t (&u)[8],
+    const bool needs_shift, const int s, const int complement_s, const std::integral_constant<std::size_t, 8>&) noexcept
+{
+    un[8] = needs_shift ? (u[7] >> complement_s) : 0;
+    for (std::size_t i {7}; i > 0; --i)
+    {
+        un[i] = needs_shift ? ((u[i] << s) | (u[i - 1] >> complement_s)) : u[i];
+    }
+    un[0] = needs_shift ? (u[0] << s) : u[0];
+}
+
 // See: The Art of Computer Programming Volume 2 (Semi-numerical algorithms) section 4.3.1
 // Algorithm D: Division of Non-negative integers
 template <bool need_remainder, std::size_t u_size, std::size_t v_size, std::size_t q_size>
@@ -103,14 +230,11 @@ constexpr void knuth_divide(std::uint32_t (&u)[u_size], const std::size_t m,
     const bool needs_shift {s > 0};
 
     // Create normalized versions of u and v
-    std::uint32_t un[5] {};
+    std::uint32_t un[u_size + 1] {};
     std::uint32_t vn[4] {};
 
-    un[4] = needs_shift ? (u[3] >> complement_s) : 0;
-    un[3] = needs_shift ? ((u[3] << s) | (u[2] >> complement_s)) : u[3];
-    un[2] = needs_shift ? ((u[2] << s) | (u[1] >> complement_s)) : u[2];
-    un[1] = needs_shift ? ((u[1] << s) | (u[0] >> complement_s)) : u[1];
-    un[0] = needs_shift ? (u[0] << s) : u[0];
+    static_assert(u_size == 4 || u_size == 8, "Unknown size for numerator");
+    unpack_u(un, u, needs_shift, s, complement_s, std::integral_constant<std::size_t, u_size>{});
 
     static_assert(v_size == 4 || v_size == 2, "Unknown size for denominator");
     unpack_v(vn, v, needs_shift, s, complement_s, std::integral_constant<std::size_t, v_size>{});
@@ -417,16 +541,8 @@ BOOST_INT128_FORCE_INLINE constexpr void one_word_div(const T& lhs, const std::u
     }
     else
     {
-        std::uint32_t u[4] {};
-        std::uint32_t v[2] {};
-        std::uint32_t q[4] {};
-
-        const auto m {impl::to_words(lhs, u)};
-        const auto n {impl::to_words(rhs, v)};
-
-        impl::knuth_divide<false>(u, m, v, n, q);
-
-        quotient = impl::from_words<T>(q);
+        std::uint64_t remainder {};
+        quotient = impl::mg_div_one_limb(lhs, rhs, remainder);
     }
 }
 
@@ -453,17 +569,9 @@ BOOST_INT128_FORCE_INLINE constexpr void one_word_div(const T& lhs, const std::u
     }
     else
     {
-        std::uint32_t u[4] {};
-        std::uint32_t v[2] {};
-        std::uint32_t q[4] {};
-
-        const auto m {impl::to_words(lhs, u)};
-        const auto n {impl::to_words(rhs, v)};
-
-        impl::knuth_divide<true>(u, m, v, n, q);
-
-        quotient = impl::from_words<T>(q);
-        remainder = impl::from_words<T>(u);
+        std::uint64_t remainder_low {};
+        quotient = impl::mg_div_one_limb(lhs, rhs, remainder_low);
+        remainder = T{0, remainder_low};
     }
 
     #endif
@@ -550,6 +658,71 @@ BOOST_INT128_FORCE_INLINE constexpr T knuth_div(const T& dividend, const T& divi
     return impl::from_words<T>(q);
 }
 
+// Divides the 256-bit value (high, low) by divisor where high < divisor so that the quotient fits into T
+// This is far too slow for the hot path, and is used to precompute constants (e.g. reciprocals)
+template <typename T>
+constexpr T knuth_div_wide(const T& high, const T& low, const T& divisor, T& remainder) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    BOOST_INT128_ASSERT_MSG(high < divisor, "Quotient does not fit into 128 bits");
+
+    std::uint32_t u[8] {};
+    std::uint32_t v[4] {};
+    std::uint32_t q[8] {};
+
+    std::uint32_t low_words[4] {};
+    std::uint32_t high_words[4] {};
+    to_words(low, low_words);
+    to_words(high, high_words);
+
+    for (std::size_t i {}; i < 4U; ++i)
+    {
+        u[i] = low_words[i];
+        u[i + 4U] = high_words[i];
+    }
+
+    std::size_t m {8};
+    while (m > 0U && u[m - 1U] == 0U)
+    {
+        --m;
+    }
+
+    const auto n {impl::to_words(divisor, v)};
+
+    if (m < n)
+    {
+        remainder = low;
+        return T{0, 0};
+    }
+
+    if (n == 1U)
+    {
+        std::uint64_t r {};
+        for (std::size_t i {m - 1U}; i != static_cast<std::size_t>(-1); --i)
+        {
+            const auto current {(r << 32U) | u[i]};
+            q[i] = static_cast<std::uint32_t>(current / v[0]);
+            r = current % v[0];
+        }
+
+        remainder = T{0, r};
+    }
+    else
+    {
+        impl::knuth_divide<true>(u, m, v, n, q);
+
+        const auto remainder_low {static_cast<std::uint64_t>(u[0]) | (static_cast<std::uint64_t>(u[1]) << 32U)};
+        const auto remainder_high {static_cast<std::uint64_t>(u[2]) | (static_cast<std::uint64_t>(u[3]) << 32U)};
+        remainder = T{static_cast<high_word_type>(remainder_high), remainder_low};
+    }
+
+    const auto quotient_low {static_cast<std::uint64_t>(q[0]) | (static_cast<std::uint64_t>(q[1]) << 32U)};
+    const auto quotient_high {static_cast<std::uint64_t>(q[2]) | (static_cast<std::uint64_t>(q[3]) << 32U)};
+
+    return T{static_cast<high_word_type>(quotient_high), quotient_low};
+}
+
 #ifdef _MSC_VER
 #  pragma warning(pop)
 #endif
@@ -99,6 +99,87 @@ BOOST_INT128_FORCE_INLINE constexpr void to_words(const std::uint32_t x, std::ui
     words[0] = x;
 }
 
+// Full 64 x 64 -> 128 bit product, returns the low word and stores the high word
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t umul64(const std::uint64_t lhs, const std::uint64_t rhs, std::uint64_t& high) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128)
+
+    const auto product {static_cast<builtin_u128>(lhs) * rhs};
+    high = static_cast<std::uint64_t>(product >> 64U);
+    return static_cast<std::uint64_t>(product);
+
+    #else
+
+    #if defined(_M_AMD64) && !defined(__GNUC__) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+    {
+        return _umul128(lhs, rhs, &high);
+    }
+
+    #elif defined(_M_ARM64) && !defined(__GNUC__) && !defined(BOOST_INT128_NO_CONSTEVAL_DETECTION)
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(lhs))
+    {
+        high = __umulh(lhs, rhs);
+        return lhs * rhs;
+    }
+
+    #endif
+
+    const auto lhs_low {lhs & UINT32_MAX};
+    const auto lhs_high {lhs >> 32U};
+    const auto rhs_low {rhs & UINT32_MAX};
+    const auto rhs_high {rhs >> 32U};
+
+    const auto low_low {lhs_low * rhs_low};
+    const auto high_low {lhs_high * rhs_low};
+    const auto low_high {lhs_low * rhs_high};
+    const auto high_high {lhs_high * rhs_high};
+
+    // Can not overflow: (2^32 - 1) * 2 + (2^32 - 1)^2 == 2^64 - 1
+    const auto cross {(low_low >> 32U) + (high_low & UINT32_MAX) + low_high};
+
+    high = high_high + (high_low >> 32U) + (cross >> 32U);
+    return (cross << 32U) | (low_low & UINT32_MAX);
+
+    #endif
+}
+
+// Full 128 x 128 -> 256 bit product of two unsigned values, returns the low half and stores the high half
+template <typename T>
+BOOST_INT128_FORCE_INLINE constexpr T umul_wide(const T& lhs, const T& rhs, T& high) noexcept
+{
+    using high_word_type = decltype(T{}.high);
+
+    const auto lhs_high {static_cast<std::uint64_t>(lhs.high)};
+    const auto rhs_high {static_cast<std::uint64_t>(rhs.high)};
+
+    std::uint64_t p00_high {};
+    const auto p00_low {umul64(lhs.low, rhs.low, p00_high)};
+    std::uint64_t p01_high {};
+    const auto p01_low {umul64(lhs.low, rhs_high, p01_high)};
+    std::uint64_t p10_high {};
+    const auto p10_low {umul64(lhs_high, rhs.low, p10_high)};
+    std::uint64_t p11_high {};
+    const auto p11_low {umul64(lhs_high, rhs_high, p11_high)};
+
+    auto middle {p00_high + p01_low};
+    std::uint64_t middle_carry {middle < p01_low};
+    middle += p10_low;
+    middle_carry += middle < p10_low;
+
+    auto upper {p11_low + p01_high};
+    std::uint64_t upper_carry {upper < p01_high};
+    upper += p10_high;
+    upper_carry += upper < p10_high;
+    upper += middle_carry;
+    upper_carry += upper < middle_carry;
+
+    high = T{static_cast<high_word_type>(p11_high + upper_carry), upper};
+    return T{static_cast<high_word_type>(middle), p00_low};
+}
+
 } // namespace detail
 } // namespace int128
 } // namespace boost
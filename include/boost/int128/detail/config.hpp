@@ -169,6 +169,18 @@ using builtin_u128 = std::_Unsigned128;
 
 #endif // Platform macros
 
+// Kernels for newer instruction sets are compiled for their own target and selected at runtime.
+// Define BOOST_INT128_NO_SIMD to always use the portable code.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER) && !defined(BOOST_INT128_NO_SIMD)
+#  define BOOST_INT128_HAS_X86_DISPATCH
+#  define BOOST_INT128_TARGET_SSE41 __attribute__((target("sse4.1")))
+#  define BOOST_INT128_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_M_AMD64) && defined(_MSC_VER) && !defined(__clang__) && !defined(BOOST_INT128_NO_SIMD)
+#  define BOOST_INT128_HAS_X86_DISPATCH
+#  define BOOST_INT128_TARGET_SSE41
+#  define BOOST_INT128_TARGET_AVX2
+#endif
+
 // The builtin is only constexpr from clang-7 or GCC-10
 #ifdef __has_builtin
 #  if __has_builtin(__builtin_sub_overflow) && ((defined(__clang__) && __clang_major__ >= 7) || (defined(__GNUC__) && __GNUC__ >= 10))
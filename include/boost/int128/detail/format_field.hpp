@@ -0,0 +1,82 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_DETAIL_FORMAT_FIELD_HPP
+#define BOOST_INT128_DETAIL_FORMAT_FIELD_HPP
+
+#include <boost/int128/detail/mini_to_chars.hpp>
+#include <boost/int128/detail/config.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstddef>
+
+#endif
+
+namespace boost {
+namespace int128 {
+namespace detail {
+
+// The sign, base prefix and digits of a formatted value, shared by the formatters and the streams
+
+// Where the padding up to the field width goes
+enum class field_align
+{
+    right,      // Before everything
+    left,       // After everything
+    center,     // Split, with the odd character after
+    internal    // Between the sign and base prefix and the digits
+};
+
+// Sign, base prefix and up to 128 binary digits
+BOOST_INT128_INLINE_CONSTEXPR std::ptrdiff_t max_field_chars {3 + 128};
+
+// Writes the sign, the base prefix and the digits of magnitude to buffer, which needs room for max_field_chars.
+// A sign of '\0' writes none. Returns one past the end, and digits is set to the start of the digits.
+constexpr char* write_integer_field(char* buffer, const uint128_t magnitude, const char sign, const char* prefix,
+                                    const int base, const bool uppercase, char*& digits) noexcept
+{
+    auto p {buffer};
+    if (sign != '\0')
+    {
+        *p++ = sign;
+    }
+
+    while (*prefix != '\0')
+    {
+        *p++ = *prefix++;
+    }
+
+    digits = p;
+    return to_chars_impl(p, buffer + max_field_chars, magnitude, base, uppercase).ptr;
+}
+
+// Writes [first, last) padded to width, through copy(first, last) for the characters and fill(count) for the padding.
+// digits separates the sign and base prefix from the digits for field_align::internal.
+// Returns false as soon as copy or fill does.
+template <typename Copy, typename Fill>
+bool write_padded(const char* first, const char* digits, const char* last, const std::ptrdiff_t width,
+                  const field_align align, Copy copy, Fill fill)
+{
+    const auto size {last - first};
+    const auto padding {width > size ? width - size : 0};
+
+    switch (align)
+    {
+        case field_align::left:
+            return copy(first, last) && fill(padding);
+        case field_align::center:
+            return fill(padding / 2) && copy(first, last) && fill(padding - padding / 2);
+        case field_align::internal:
+            return copy(first, digits) && fill(padding) && copy(digits, last);
+        default:
+            return fill(padding) && copy(first, last);
+    }
+}
+
+} // namespace detail
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_DETAIL_FORMAT_FIELD_HPP
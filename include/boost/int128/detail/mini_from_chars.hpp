@@ -8,17 +8,40 @@
 
 #include <boost/int128/detail/uint128_imp.hpp>
 #include <boost/int128/detail/int128_imp.hpp>
+#include <boost/int128/detail/pow10.hpp>
+#include <boost/int128/numeric.hpp>
 
 #ifndef BOOST_INT128_BUILD_MODULE
 
+#include <system_error>
 #include <cerrno>
 #include <limits>
 #include <cstddef>
+#include <cstdint>
 
 #endif
 
 namespace boost {
 namespace int128 {
+
+BOOST_INT128_EXPORT struct from_chars_result
+{
+    const char* ptr;
+    std::errc ec;
+
+    friend constexpr bool operator==(const from_chars_result& lhs, const from_chars_result& rhs) noexcept
+    {
+        return lhs.ptr == rhs.ptr && lhs.ec == rhs.ec;
+    }
+
+    friend constexpr bool operator!=(const from_chars_result& lhs, const from_chars_result& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
 namespace detail {
 
 namespace impl {
@@ -98,7 +121,6 @@ constexpr int from_chars_integer_impl(const char* first, const char* last, Integ
 
 
     overflow_value /= unsigned_base;
-    overflow_value <<= 1;
     max_digit %= unsigned_base;
 
     // If the only character was a sign abort now
@@ -184,7 +206,198 @@ constexpr int from_chars(const char* first, const char* last, int128_t& value, i
     return impl::from_chars_integer_impl<int128_t, uint128_t>(first, last, value, base);
 }
 
+// Appends a chunk of count digits in base to the magnitude with a single checked multiply-add.
+// Full chunks take the multiplier from the table, and only the last chunk of a number can be partial.
+BOOST_INT128_FORCE_INLINE constexpr void append_chunk(uint128_t& magnitude, bool& overflow, const std::uint64_t chunk,
+                                                      const int base, const std::ptrdiff_t count) noexcept
+{
+    auto multiplier {base_chunk_pow[base]};
+    if (count < static_cast<std::ptrdiff_t>(base_chunk_digits[base]))
+    {
+        if (base == 10)
+        {
+            multiplier = pow10_u128[count].low;
+        }
+        else
+        {
+            multiplier = 1U;
+            for (std::ptrdiff_t i {}; i < count; ++i)
+            {
+                multiplier *= static_cast<std::uint64_t>(base);
+            }
+        }
+    }
+
+    // The multiplier always fits the low word, and a zero high word keeps the product cheap
+    uint128_t shifted {};
+    const auto mul_overflow {umul_overflow(magnitude, uint128_t{multiplier}, shifted)};
+    magnitude = shifted + chunk;
+    overflow = overflow || mul_overflow || magnitude < shifted;
+}
+
+// Base 10 version of parse_magnitude below, where a chunk is 19 digits
+// and the multiplier comes from the table of powers of ten
+constexpr const char* parse_decimal_magnitude(const char* first, const char* last, uint128_t& magnitude, bool& overflow) noexcept
+{
+    constexpr std::ptrdiff_t chunk_digits {19};
+
+    uint128_t result {};
+    bool overflowed {false};
+    auto next {first};
+
+    while (next < last)
+    {
+        const auto chunk_first {next};
+        const auto chunk_last {last - next > chunk_digits ? next + chunk_digits : last};
+
+        std::uint64_t chunk {};
+        while (next < chunk_last)
+        {
+            const auto digit {static_cast<std::uint64_t>(static_cast<unsigned char>(*next)) - static_cast<std::uint64_t>('0')};
+            if (digit > 9U)
+            {
+                break;
+            }
+
+            chunk = chunk * 10U + digit;
+            ++next;
+        }
+
+        const auto count {next - chunk_first};
+        if (count == 0)
+        {
+            break;
+        }
+
+        append_chunk(result, overflowed, chunk, 10, count);
+
+        if (count < chunk_digits)
+        {
+            break;
+        }
+    }
+
+    magnitude = result;
+    overflow = overflowed;
+
+    return next;
+}
+
+// Accumulates the digits at [first, last) in chunks of base_chunk_digits, which fit a 64-bit word,
+// then appends each chunk to the magnitude with a single checked multiply-add.
+// Returns the end of the digits, and overflow is set if the magnitude does not fit in 128 bits.
+constexpr const char* parse_magnitude(const char* first, const char* last, const int base, uint128_t& magnitude, bool& overflow) noexcept
+{
+    if (base == 10)
+    {
+        return parse_decimal_magnitude(first, last, magnitude, overflow);
+    }
+
+    const auto unsigned_base {static_cast<std::uint64_t>(base)};
+    const auto chunk_digits {static_cast<std::ptrdiff_t>(base_chunk_digits[base])};
+
+    uint128_t result {};
+    bool overflowed {false};
+    auto next {first};
+
+    while (next < last)
+    {
+        const auto chunk_first {next};
+        const auto chunk_last {last - next > chunk_digits ? next + chunk_digits : last};
+
+        std::uint64_t chunk {};
+        while (next < chunk_last)
+        {
+            const auto digit {static_cast<std::uint64_t>(impl::digit_from_char(*next))};
+            if (digit >= unsigned_base)
+            {
+                break;
+            }
+
+            chunk = chunk * unsigned_base + digit;
+            ++next;
+        }
+
+        const auto count {next - chunk_first};
+        if (count == 0)
+        {
+            break;
+        }
+
+        append_chunk(result, overflowed, chunk, base, count);
+
+        if (count < chunk_digits)
+        {
+            break;
+        }
+    }
+
+    magnitude = result;
+    overflow = overflowed;
+
+    return next;
+}
+
 } // namespace detail
+
+// Parses an integer from [first, last) in the manner of std::from_chars.
+// There is no leading whitespace or '+', and only int128_t accepts a leading '-'.
+// Without any digits returns {first, std::errc::invalid_argument}.
+// If the value is out of range, returns the end of the digits with std::errc::result_out_of_range.
+// value is only modified on success.
+
+BOOST_INT128_EXPORT constexpr from_chars_result from_chars(const char* first, const char* last, uint128_t& value, const int base = 10) noexcept
+{
+    BOOST_INT128_ASSERT_MSG(base >= 2 && base <= 36, "Base must be between 2 and 36");
+
+    uint128_t magnitude {};
+    bool overflow {};
+    const auto end {detail::parse_magnitude(first, last, base, magnitude, overflow)};
+
+    if (end == first)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+    if (overflow)
+    {
+        return {end, std::errc::result_out_of_range};
+    }
+
+    value = magnitude;
+    return {end, std::errc{}};
+}
+
+BOOST_INT128_EXPORT constexpr from_chars_result from_chars(const char* first, const char* last, int128_t& value, const int base = 10) noexcept
+{
+    BOOST_INT128_ASSERT_MSG(base >= 2 && base <= 36, "Base must be between 2 and 36");
+
+    auto next {first};
+    const auto is_negative {next < last && *next == '-'};
+    if (is_negative)
+    {
+        ++next;
+    }
+
+    uint128_t magnitude {};
+    bool overflow {};
+    const auto end {detail::parse_magnitude(next, last, base, magnitude, overflow)};
+
+    if (end == next)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // The magnitude of the minimum value is one more than that of the maximum
+    const auto limit {static_cast<uint128_t>((std::numeric_limits<int128_t>::max)()) + static_cast<unsigned>(is_negative)};
+    if (overflow || magnitude > limit)
+    {
+        return {end, std::errc::result_out_of_range};
+    }
+
+    value = static_cast<int128_t>(is_negative ? uint128_t{0} - magnitude : magnitude);
+    return {end, std::errc{}};
+}
+
 } // namespace int128
 } // namespace boost
 
@@ -8,100 +8,430 @@
 
 #include <boost/int128/detail/uint128_imp.hpp>
 #include <boost/int128/detail/int128_imp.hpp>
+#include <boost/int128/bit.hpp>
+#include <boost/int128/divider.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <system_error>
+#include <cstddef>
+#include <cstdint>
+
+#endif
 
 namespace boost {
 namespace int128 {
+
+BOOST_INT128_EXPORT struct to_chars_result
+{
+    char* ptr;
+    std::errc ec;
+
+    friend constexpr bool operator==(const to_chars_result& lhs, const to_chars_result& rhs) noexcept
+    {
+        return lhs.ptr == rhs.ptr && lhs.ec == rhs.ec;
+    }
+
+    friend constexpr bool operator!=(const to_chars_result& lhs, const to_chars_result& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
 namespace detail {
 
 static constexpr char lower_case_digit_table[] = {
     '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
-    'a', 'b', 'c', 'd', 'e', 'f'
+    'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j',
+    'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't',
+    'u', 'v', 'w', 'x', 'y', 'z'
 };
 
-static_assert(sizeof(lower_case_digit_table) == sizeof(char) * 16, "10 numbers, and 6 letters");
+static_assert(sizeof(lower_case_digit_table) == sizeof(char) * 36, "10 numbers, and 26 letters");
 
 static constexpr char upper_case_digit_table[] = {
     '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
-    'A', 'B', 'C', 'D', 'E', 'F'
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J',
+    'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T',
+    'U', 'V', 'W', 'X', 'Y', 'Z'
 };
 
-static_assert(sizeof(upper_case_digit_table) == sizeof(char) * 16, "10 numbers, and 6 letters");
+static_assert(sizeof(upper_case_digit_table) == sizeof(char) * 36, "10 numbers, and 26 letters");
 
-constexpr char* mini_to_chars(char (&buffer)[64], uint128_t v, const int base, const bool uppercase) noexcept
+// The two digit decimal strings "00" through "99" back to back
+static constexpr char digit_pairs[] = {
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899"
+};
+
+BOOST_INT128_FORCE_INLINE constexpr void write_digit_pair(char* first, const std::uint32_t pair) noexcept
 {
-    char* last {buffer + 64U};
-    *--last = '\0';
+    first[0] = digit_pairs[2U * pair];
+    first[1] = digit_pairs[2U * pair + 1U];
+}
 
-    if (v == 0U)
+// Writes the eight decimal digits of v < 10^8 starting at first.
+// The four pairs come from independent 32-bit divisions by constants.
+BOOST_INT128_FORCE_INLINE constexpr void write_eight_digits(char* first, const std::uint32_t v) noexcept
+{
+    const auto upper {v / 10000U};
+    const auto lower {v % 10000U};
+
+    write_digit_pair(first, upper / 100U);
+    write_digit_pair(first + 2, upper % 100U);
+    write_digit_pair(first + 4, lower / 100U);
+    write_digit_pair(first + 6, lower % 100U);
+}
+
+// Writes exactly count decimal digits of v, zero padded, ending just before last
+constexpr void write_decimal(char* last, std::uint64_t v, int count) noexcept
+{
+    while (count > 8)
+    {
+        last -= 8;
+        write_eight_digits(last, static_cast<std::uint32_t>(v % 100000000U));
+        v /= 100000000U;
+        count -= 8;
+    }
+
+    auto w {static_cast<std::uint32_t>(v)};
+
+    while (count >= 2)
+    {
+        last -= 2;
+        write_digit_pair(last, w % 100U);
+        w /= 100U;
+        count -= 2;
+    }
+
+    if (count == 1)
+    {
+        *--last = static_cast<char>('0' + w);
+    }
+}
+
+// Writes the digits decimal digits of value starting at first, and returns one past the last of them
+constexpr char* write_decimal_digits(char* first, const uint128_t value, const int digits) noexcept
+{
+    const auto end {first + digits};
+
+    if (value.high == 0U)
+    {
+        write_decimal(end, value.low, digits);
+        return end;
+    }
+
+    // At most two constant divisions split the value into 10^19 chunks,
+    // and everything after that runs on 64-bit words
+    constexpr std::uint64_t ten_19 {UINT64_C(10000000000000000000)};
+
+    const auto upper {div_by<ten_19>(value)};
+    write_decimal(end, (value - upper * ten_19).low, 19);
+
+    if (upper.high == 0U)
+    {
+        write_decimal(end - 19, upper.low, digits - 19);
+    }
+    else
     {
-        *--last = '0';
-        return last;
+        const auto top {div_by<ten_19>(upper)};
+        write_decimal(end - 19, (upper - top * ten_19).low, 19);
+        write_decimal(end - 38, top.low, digits - 38);
+    }
+
+    return end;
+}
+
+constexpr to_chars_result to_chars_decimal(char* first, char* last, const uint128_t value) noexcept
+{
+    const auto digits {num_digits(value)};
+    if (last - first < digits)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    return {write_decimal_digits(first, value, digits), std::errc{}};
+}
+
+// Bases 2, 4, 8, 16 and 32 take a fixed number of bits per digit
+constexpr to_chars_result to_chars_power_of_two(char* first, char* last, uint128_t value, const int base, const bool uppercase) noexcept
+{
+    const auto digits {num_digits(value, base)};
+    if (last - first < digits)
+    {
+        return {last, std::errc::value_too_large};
     }
 
     const auto digit_table {uppercase ? upper_case_digit_table : lower_case_digit_table};
+    const auto shift {detail::countr_zero(static_cast<std::uint32_t>(base))};
+    const auto mask {static_cast<std::uint64_t>(base) - 1U};
 
-    switch (base)
+    const auto end {first + digits};
+    for (auto p {end}; p != first; value >>= shift)
     {
-        case 8:
-            while (v != 0U)
-            {
-                constexpr unsigned zero {48U};
-                *--last = static_cast<char>(zero + (v & 7U));
-                v >>= 3U;
-            }
-            break;
+        *--p = digit_table[static_cast<std::size_t>(value.low & mask)];
+    }
 
-        case 10:
-            while (v != 0U)
-            {
-                *--last = digit_table[static_cast<std::size_t>(v % 10U)];
-                v /= 10U;
-            }
-            break;
+    return {end, std::errc{}};
+}
+
+// Writes exactly count digits of v in base, zero padded, ending just before last.
+// Once the rest fits in 32 bits the divisions switch to the cheaper 32-bit ones.
+constexpr void write_base_digits(char* last, std::uint64_t v, int count, const std::uint32_t base, const char* digit_table) noexcept
+{
+    for (; count > 0 && v > UINT32_MAX; --count)
+    {
+        *--last = digit_table[v % base];
+        v /= base;
+    }
+
+    auto w {static_cast<std::uint32_t>(v)};
+    for (; count > 0; --count)
+    {
+        *--last = digit_table[w % base];
+        w /= base;
+    }
+}
+
+// Every other base from 3 to 36. At most two divisions by the largest power of the base that fits
+// in a word split the value into chunks, and everything after that runs on 64-bit words
+constexpr to_chars_result to_chars_chunked(char* first, char* last, const uint128_t value, const int base, const bool uppercase) noexcept
+{
+    const auto digit_table {uppercase ? upper_case_digit_table : lower_case_digit_table};
+    const auto unsigned_base {static_cast<std::uint32_t>(base)};
+    const auto chunk {base_chunk_pow[base]};
+    const auto chunk_digits {static_cast<int>(base_chunk_digits[base])};
 
-        case 16:
-            while (v != 0U)
-            {
-                *--last = digit_table[static_cast<std::size_t>(v & 15U)];
-                v >>= 4U;
-            }
+    // Every chunk is above 2^59, so the quotient fits in one word after at most two divisions
+    std::uint64_t chunks[2] {};
+    int num_chunks {};
+    auto remaining {value};
+    while (remaining.high != 0U)
+    {
+        const auto upper {remaining / chunk};
+        chunks[num_chunks++] = (remaining - upper * chunk).low;
+        remaining = upper;
+    }
+
+    // Counting the digits of the leading word needs only multiplications
+    const auto top {remaining.low};
+    int top_digits {1};
+    for (std::uint64_t power {unsigned_base}; power <= top; power *= unsigned_base)
+    {
+        ++top_digits;
+        if (power > UINT64_MAX / unsigned_base)
+        {
             break;
+        }
+    }
+
+    const auto digits {top_digits + num_chunks * chunk_digits};
+    if (last - first < digits)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    const auto end {first + digits};
+    auto p {end};
+    for (int i {}; i < num_chunks; ++i)
+    {
+        write_base_digits(p, chunks[i], chunk_digits, unsigned_base, digit_table);
+        p -= chunk_digits;
+    }
+
+    write_base_digits(p, top, top_digits, unsigned_base, digit_table);
+
+    return {end, std::errc{}};
+}
+
+constexpr to_chars_result to_chars_impl(char* first, char* last, const uint128_t value, const int base, const bool uppercase) noexcept
+{
+    BOOST_INT128_ASSERT_MSG(base >= 2 && base <= 36, "Base must be between 2 and 36");
 
-        default:                        // LCOV_EXCL_LINE
-            BOOST_INT128_UNREACHABLE;   // LCOV_EXCL_LINE
+    if (base == 10)
+    {
+        return to_chars_decimal(first, last, value);
     }
 
-    return last;
+    if ((base & (base - 1)) == 0)
+    {
+        return to_chars_power_of_two(first, last, value, base, uppercase);
+    }
+
+    return to_chars_chunked(first, last, value, base, uppercase);
+}
+
+constexpr bool is_negative(const uint128_t) noexcept
+{
+    return false;
+}
+
+constexpr bool is_negative(const int128_t value) noexcept
+{
+    return value < 0;
+}
+
+constexpr uint128_t unsigned_magnitude(const uint128_t value) noexcept
+{
+    return value;
 }
 
-constexpr char* mini_to_chars(char (&buffer)[64], const int128_t v, const int base, const bool uppercase) noexcept
+constexpr uint128_t unsigned_magnitude(const int128_t value) noexcept
 {
-    char* p {nullptr};
+    // Negating in the unsigned type also handles the minimum value
+    return value < 0 ? uint128_t{0} - static_cast<uint128_t>(value) : static_cast<uint128_t>(value);
+}
 
-    if (v < 0)
+constexpr to_chars_result to_chars_impl(char* first, char* last, const int128_t value, const int base, const bool uppercase) noexcept
+{
+    if (value < 0)
     {
-        // We cant negate the min value inside the signed type, but we know what the result will be
-        if (v == (std::numeric_limits<int128_t>::min)())
+        if (first == last)
         {
-            p = mini_to_chars(buffer, uint128_t{UINT64_C(0x8000000000000000), 0}, base, uppercase);
+            return {last, std::errc::value_too_large};
         }
-        else
+
+        *first++ = '-';
+    }
+
+    return to_chars_impl(first, last, unsigned_magnitude(value), base, uppercase);
+}
+
+} // namespace detail
+
+// Writes value into [first, last) in a base from 2 to 36 without a terminating null character.
+// Digits above 9 are lower case, and negative values get a leading minus sign.
+// If the buffer is too small, returns {last, std::errc::value_too_large}.
+
+BOOST_INT128_EXPORT constexpr to_chars_result to_chars(char* first, char* last, const uint128_t value, const int base = 10) noexcept
+{
+    return detail::to_chars_impl(first, last, value, base, false);
+}
+
+BOOST_INT128_EXPORT constexpr to_chars_result to_chars(char* first, char* last, const int128_t value, const int base = 10) noexcept
+{
+    return detail::to_chars_impl(first, last, value, base, false);
+}
+
+namespace detail {
+
+constexpr std::size_t decimal_size(const uint128_t value) noexcept
+{
+    return static_cast<std::size_t>(num_digits(value));
+}
+
+constexpr std::size_t decimal_size(const int128_t value) noexcept
+{
+    return static_cast<std::size_t>(is_negative(value)) + decimal_size(unsigned_magnitude(value));
+}
+
+// Writes value in decimal without a bound, for callers that have already sized the output exactly
+constexpr char* write_decimal_value(char* out, const uint128_t value) noexcept
+{
+    return write_decimal_digits(out, value, num_digits(value));
+}
+
+constexpr char* write_decimal_value(char* out, const int128_t value) noexcept
+{
+    if (value < 0)
+    {
+        *out++ = '-';
+    }
+
+    return write_decimal_value(out, unsigned_magnitude(value));
+}
+
+template <typename T>
+constexpr std::size_t format_n_size_impl(const T* in, const std::size_t n) noexcept
+{
+    std::size_t size {n == 0U ? 0U : n - 1U};
+    for (std::size_t i {}; i < n; ++i)
+    {
+        size += decimal_size(in[i]);
+    }
+
+    return size;
+}
+
+template <typename T>
+constexpr char* format_n_impl(const T* in, const std::size_t n, char* out, const char sep) noexcept
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        if (i != 0U)
         {
-            const auto neg_v {-v};
-            p = mini_to_chars(buffer, static_cast<uint128_t>(neg_v), base, uppercase);
+            *out++ = sep;
         }
 
-        *--p = '-';
+        out = write_decimal_value(out, in[i]);
     }
-    else
+
+    return out;
+}
+
+template <typename T>
+constexpr char* format_n_impl(const T* in, const std::size_t n, char* out, std::size_t* offsets) noexcept
+{
+    const auto first {out};
+
+    offsets[0] = 0U;
+    for (std::size_t i {}; i < n; ++i)
     {
-        p = mini_to_chars(buffer, static_cast<uint128_t>(v), base, uppercase);
+        out = write_decimal_value(out, in[i]);
+        offsets[i + 1U] = static_cast<std::size_t>(out - first);
     }
 
-    return p;
+    return out;
 }
 
 } // namespace detail
+
+// Returns the exact number of characters format_n writes for the n values at in,
+// which is the length of every value in decimal plus n - 1 separators
+
+BOOST_INT128_EXPORT constexpr std::size_t format_n_size(const uint128_t* in, const std::size_t n) noexcept
+{
+    return detail::format_n_size_impl(in, n);
+}
+
+BOOST_INT128_EXPORT constexpr std::size_t format_n_size(const int128_t* in, const std::size_t n) noexcept
+{
+    return detail::format_n_size_impl(in, n);
+}
+
+// Writes the n values at in to out in decimal, with sep between consecutive values
+// and no terminating null character. Returns one past the last character written.
+// out needs room for format_n_size(in, n) characters.
+
+BOOST_INT128_EXPORT constexpr char* format_n(const uint128_t* in, const std::size_t n, char* out, const char sep) noexcept
+{
+    return detail::format_n_impl(in, n, out, sep);
+}
+
+BOOST_INT128_EXPORT constexpr char* format_n(const int128_t* in, const std::size_t n, char* out, const char sep) noexcept
+{
+    return detail::format_n_impl(in, n, out, sep);
+}
+
+// Writes the n values at in to out in decimal back to back, for columnar output.
+// Value i occupies [out + offsets[i], out + offsets[i + 1]), so offsets needs n + 1 entries.
+// There are no separators, so out needs room for format_n_size(in, n) - (n - 1) characters when n > 0.
+
+BOOST_INT128_EXPORT constexpr char* format_n(const uint128_t* in, const std::size_t n, char* out, std::size_t* offsets) noexcept
+{
+    return detail::format_n_impl(in, n, out, offsets);
+}
+
+BOOST_INT128_EXPORT constexpr char* format_n(const int128_t* in, const std::size_t n, char* out, std::size_t* offsets) noexcept
+{
+    return detail::format_n_impl(in, n, out, offsets);
+}
+
 } // namespace int128
 } // namespace boost
 
@@ -0,0 +1,412 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_DETAIL_PARSE_COLUMN_HPP
+#define BOOST_INT128_DETAIL_PARSE_COLUMN_HPP
+
+#include <boost/int128/detail/config.hpp>
+#include <boost/int128/detail/uint128_imp.hpp>
+#include <boost/int128/detail/ctz.hpp>
+#include <boost/int128/detail/pow10.hpp>
+#include <boost/int128/detail/mini_from_chars.hpp>
+#include <boost/int128/numeric.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <system_error>
+#include <cstddef>
+#include <cstdint>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+BOOST_INT128_EXPORT struct parse_column_result
+{
+    const char* ptr;
+    std::size_t count;
+    std::errc ec;
+
+    friend constexpr bool operator==(const parse_column_result& lhs, const parse_column_result& rhs) noexcept
+    {
+        return lhs.ptr == rhs.ptr && lhs.count == rhs.count && lhs.ec == rhs.ec;
+    }
+
+    friend constexpr bool operator!=(const parse_column_result& lhs, const parse_column_result& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+namespace detail {
+
+// Parses the field at first, which has to end at delim or last.
+// On success first moves to the start of the next field.
+inline std::errc parse_column_field(const char*& first, const char* last, const char delim, uint128_t& value) noexcept
+{
+    const auto r {int128::from_chars(first, last, value)};
+    if (r.ec != std::errc{})
+    {
+        return r.ec;
+    }
+
+    if (r.ptr == last)
+    {
+        first = last;
+    }
+    else if (*r.ptr == delim)
+    {
+        first = r.ptr + 1;
+    }
+    else
+    {
+        return std::errc::invalid_argument;
+    }
+
+    return std::errc{};
+}
+
+// Parses the remaining fields one at a time, with count values already stored in out
+inline parse_column_result parse_column_scalar(const char* first, const char* last, const char delim, uint128_t* out, std::size_t count) noexcept
+{
+    while (first < last)
+    {
+        uint128_t value {};
+        const auto ec {parse_column_field(first, last, delim, value)};
+        if (ec != std::errc{})
+        {
+            return {first, count, ec};
+        }
+
+        out[count++] = value;
+    }
+
+    return {last, count, std::errc{}};
+}
+
+#ifdef BOOST_INT128_HAS_X86_DISPATCH
+
+enum class simd_level
+{
+    scalar,
+    sse41,
+    avx2
+};
+
+inline simd_level detect_simd_level() noexcept
+{
+    #if defined(__GNUC__) || defined(__clang__)
+
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return simd_level::avx2;
+    }
+    if (__builtin_cpu_supports("sse4.1"))
+    {
+        return simd_level::sse41;
+    }
+
+    #else
+
+    int registers[4] {};
+    __cpuid(registers, 0);
+    const auto max_leaf {registers[0]};
+
+    __cpuid(registers, 1);
+    const auto sse41 {(registers[2] & (1 << 19)) != 0};
+    const auto os_saves_ymm {(registers[2] & (1 << 27)) != 0 && (registers[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6U) == 6U};
+
+    if (max_leaf >= 7 && os_saves_ymm)
+    {
+        __cpuidex(registers, 7, 0);
+        if ((registers[1] & (1 << 5)) != 0)
+        {
+            return simd_level::avx2;
+        }
+    }
+    if (sse41)
+    {
+        return simd_level::sse41;
+    }
+
+    #endif
+
+    return simd_level::scalar;
+}
+
+inline simd_level cpu_simd_level() noexcept
+{
+    static const auto level {detect_simd_level()};
+    return level;
+}
+
+// Lets a field be longer than this only through the scalar path,
+// so that leading zeros still parse and the blocks below never exceed three
+BOOST_INT128_INLINE_CONSTEXPR int max_simd_field_digits {39};
+
+BOOST_INT128_INLINE_CONSTEXPR std::uint64_t ten_16 {UINT64_C(10000000000000000)};
+
+// Loaded at an offset of n, moves the first n bytes to the end of the register and zeroes the rest
+static constexpr std::int8_t right_align_table[] = {
+    -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+};
+
+// The bytes less '0', which leaves digits as 0 to 9 and everything else above 9
+BOOST_INT128_TARGET_SSE41 inline __m128i load_digits_sse41(const char* p) noexcept
+{
+    return _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi8('0'));
+}
+
+BOOST_INT128_TARGET_SSE41 inline std::uint32_t non_digit_mask_sse41(const __m128i digits) noexcept
+{
+    const auto is_digit {_mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits)};
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(is_digit)) ^ UINT32_C(0xFFFF);
+}
+
+// Returns the number of digits at p, counting at most 48, with 48 bytes readable
+BOOST_INT128_TARGET_SSE41 inline int digit_run_sse41(const char* p) noexcept
+{
+    for (int offset {}; offset < 48; offset += 16)
+    {
+        const auto mask {non_digit_mask_sse41(load_digits_sse41(p + offset))};
+        if (mask != 0U)
+        {
+            return offset + countr_zero(mask);
+        }
+    }
+
+    return 48;
+}
+
+// The two eight digit halves of each 128-bit lane, as left by the reductions below
+BOOST_INT128_TARGET_SSE41 inline std::uint64_t join_halves_sse41(const __m128i halves) noexcept
+{
+    const auto both {static_cast<std::uint64_t>(_mm_cvtsi128_si64(halves))};
+    return (both & UINT32_MAX) * UINT64_C(100000000) + (both >> 32U);
+}
+
+// Reduces 16 digits, most significant first, by multiply-adding adjacent lanes:
+// pairs of digits, then four digits, then eight digits
+BOOST_INT128_TARGET_SSE41 inline std::uint64_t convert_16_digits_sse41(const __m128i digits) noexcept
+{
+    const auto pairs {_mm_maddubs_epi16(digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1))};
+    const auto quads {_mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1))};
+    const auto packed {_mm_packus_epi32(quads, quads)};
+    const auto halves {_mm_madd_epi16(packed, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1))};
+
+    return join_halves_sse41(halves);
+}
+
+// Converts the first 1 to 16 digits at p, with 16 bytes readable
+BOOST_INT128_TARGET_SSE41 inline __m128i leading_digits_sse41(const char* p, const int count) noexcept
+{
+    const auto shuffle {_mm_loadu_si128(reinterpret_cast<const __m128i*>(right_align_table + count))};
+    return _mm_shuffle_epi8(load_digits_sse41(p), shuffle);
+}
+
+// Converts the length digits at p, returning true if they do not fit in 128 bits
+BOOST_INT128_TARGET_SSE41 inline bool convert_field_sse41(const char* p, const int length, uint128_t& value) noexcept
+{
+    const auto full_blocks {(length - 1) / 16};
+    const auto lead {length - 16 * full_blocks};
+
+    uint128_t result {convert_16_digits_sse41(leading_digits_sse41(p, lead))};
+    bool overflow {false};
+
+    for (auto block {p + lead}; block != p + length; block += 16)
+    {
+        uint128_t shifted {};
+        overflow = umul_overflow(result, uint128_t{ten_16}, shifted) || overflow;
+        result = shifted + convert_16_digits_sse41(load_digits_sse41(block));
+        overflow = overflow || result < shifted;
+    }
+
+    value = result;
+    return overflow;
+}
+
+BOOST_INT128_TARGET_SSE41 inline parse_column_result parse_column_sse41(const char* first, const char* last, const char delim, uint128_t* out) noexcept
+{
+    std::size_t count {};
+
+    // Every load stays inside the buffer while 48 bytes remain
+    while (last - first >= 48)
+    {
+        const auto length {digit_run_sse41(first)};
+
+        if (length == 0 || length > max_simd_field_digits || first[length] != delim)
+        {
+            // Errors and long runs of leading zeros
+            uint128_t value {};
+            const auto ec {parse_column_field(first, last, delim, value)};
+            if (ec != std::errc{})
+            {
+                return {first, count, ec};
+            }
+
+            out[count++] = value;
+            continue;
+        }
+
+        uint128_t value {};
+        if (convert_field_sse41(first, length, value))
+        {
+            return {first, count, std::errc::result_out_of_range};
+        }
+
+        out[count++] = value;
+        first += length + 1;
+    }
+
+    return parse_column_scalar(first, last, delim, out, count);
+}
+
+BOOST_INT128_TARGET_AVX2 inline std::uint32_t non_digit_mask_avx2(const char* p) noexcept
+{
+    const auto digits {_mm256_sub_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), _mm256_set1_epi8('0'))};
+    const auto is_digit {_mm256_cmpeq_epi8(_mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits)};
+    return ~static_cast<std::uint32_t>(_mm256_movemask_epi8(is_digit));
+}
+
+// Returns the number of digits at p, counting at most 64, with 64 bytes readable
+BOOST_INT128_TARGET_AVX2 inline int digit_run_avx2(const char* p) noexcept
+{
+    for (int offset {}; offset < 64; offset += 32)
+    {
+        const auto mask {non_digit_mask_avx2(p + offset)};
+        if (mask != 0U)
+        {
+            return offset + countr_zero(mask);
+        }
+    }
+
+    return 64;
+}
+
+// Converts two blocks of 16 digits at once, one in each 128-bit lane
+BOOST_INT128_TARGET_AVX2 inline uint128_t convert_32_digits_avx2(const __m128i upper, const __m128i lower) noexcept
+{
+    const auto digits {_mm256_inserti128_si256(_mm256_castsi128_si256(upper), lower, 1)};
+
+    const auto pairs {_mm256_maddubs_epi16(digits, _mm256_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1,
+                                                                     10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1))};
+    const auto quads {_mm256_madd_epi16(pairs, _mm256_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1, 100, 1, 100, 1, 100, 1, 100, 1))};
+    const auto packed {_mm256_packus_epi32(quads, quads)};
+    const auto halves {_mm256_madd_epi16(packed, _mm256_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1,
+                                                                   10000, 1, 10000, 1, 10000, 1, 10000, 1))};
+
+    const auto high {join_halves_sse41(_mm256_castsi256_si128(halves))};
+    const auto low {join_halves_sse41(_mm256_extracti128_si256(halves, 1))};
+
+    return uint128_t{high} * ten_16 + low;
+}
+
+// As convert_field_sse41, pairing up the 16 digit blocks
+BOOST_INT128_TARGET_AVX2 inline bool convert_field_avx2(const char* p, const int length, uint128_t& value) noexcept
+{
+    if (length <= 16)
+    {
+        value = uint128_t{convert_16_digits_sse41(leading_digits_sse41(p, length))};
+        return false;
+    }
+
+    if (length <= 32)
+    {
+        const auto lead {length - 16};
+        value = convert_32_digits_avx2(leading_digits_sse41(p, lead), load_digits_sse41(p + lead));
+        return false;
+    }
+
+    const auto lead {length - 32};
+    const uint128_t upper {convert_16_digits_sse41(leading_digits_sse41(p, lead))};
+    const auto lower {convert_32_digits_avx2(load_digits_sse41(p + lead), load_digits_sse41(p + lead + 16))};
+
+    uint128_t shifted {};
+    const auto overflow {umul_overflow(upper, pow10_u128[32], shifted)};
+    value = shifted + lower;
+
+    return overflow || value < shifted;
+}
+
+BOOST_INT128_TARGET_AVX2 inline parse_column_result parse_column_avx2(const char* first, const char* last, const char delim, uint128_t* out) noexcept
+{
+    std::size_t count {};
+
+    // Every load stays inside the buffer while 64 bytes remain
+    while (last - first >= 64)
+    {
+        const auto length {digit_run_avx2(first)};
+
+        if (length == 0 || length > max_simd_field_digits || first[length] != delim)
+        {
+            // Errors and long runs of leading zeros
+            uint128_t value {};
+            const auto ec {parse_column_field(first, last, delim, value)};
+            if (ec != std::errc{})
+            {
+                return {first, count, ec};
+            }
+
+            out[count++] = value;
+            continue;
+        }
+
+        uint128_t value {};
+        if (convert_field_avx2(first, length, value))
+        {
+            return {first, count, std::errc::result_out_of_range};
+        }
+
+        out[count++] = value;
+        first += length + 1;
+    }
+
+    return parse_column_scalar(first, last, delim, out, count);
+}
+
+#endif // BOOST_INT128_HAS_X86_DISPATCH
+
+} // namespace detail
+
+// Parses the decimal fields of [buf, buf + len), separated by delim, into out,
+// which needs room for one value per field. A final delimiter is optional.
+// Returns the number of values stored. On failure ptr is the start of the
+// field that failed, and ec is as from_chars reports it for that field,
+// or std::errc::invalid_argument if the digits are followed by anything but delim.
+// Uses AVX2 or SSE4.1 when the processor supports it.
+
+BOOST_INT128_EXPORT inline parse_column_result parse_column(const char* buf, const std::size_t len, const char delim, uint128_t* out) noexcept
+{
+    BOOST_INT128_ASSERT_MSG(delim < '0' || delim > '9', "The delimiter can not be a digit");
+
+    const auto last {buf + len};
+
+    #ifdef BOOST_INT128_HAS_X86_DISPATCH
+
+    const auto level {detail::cpu_simd_level()};
+    if (level == detail::simd_level::avx2)
+    {
+        return detail::parse_column_avx2(buf, last, delim, out);
+    }
+    if (level == detail::simd_level::sse41)
+    {
+        return detail::parse_column_sse41(buf, last, delim, out);
+    }
+
+    #endif // BOOST_INT128_HAS_X86_DISPATCH
+
+    return detail::parse_column_scalar(buf, last, delim, out, 0U);
+}
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_DETAIL_PARSE_COLUMN_HPP
@@ -0,0 +1,107 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_DETAIL_POW10_HPP
+#define BOOST_INT128_DETAIL_POW10_HPP
+
+#include <boost/int128/detail/config.hpp>
+#include <boost/int128/detail/uint128_imp.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstdint>
+
+#endif
+
+namespace boost {
+namespace int128 {
+namespace detail {
+
+// 10^0 through 10^38, the largest power of ten below 2^128
+BOOST_INT128_INLINE_CONSTEXPR uint128_t pow10_u128[39] = {
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000001)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x000000000000000A)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000064)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x00000000000003E8)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x0000000000002710)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x00000000000186A0)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x00000000000F4240)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x0000000000989680)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x0000000005F5E100)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x000000003B9ACA00)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x00000002540BE400)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x000000174876E800)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x000000E8D4A51000)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x000009184E72A000)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x00005AF3107A4000)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x00038D7EA4C68000)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x002386F26FC10000)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x016345785D8A0000)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x0DE0B6B3A7640000)},
+    uint128_t{UINT64_C(0x0000000000000000), UINT64_C(0x8AC7230489E80000)},
+    uint128_t{UINT64_C(0x0000000000000005), UINT64_C(0x6BC75E2D63100000)},
+    uint128_t{UINT64_C(0x0000000000000036), UINT64_C(0x35C9ADC5DEA00000)},
+    uint128_t{UINT64_C(0x000000000000021E), UINT64_C(0x19E0C9BAB2400000)},
+    uint128_t{UINT64_C(0x000000000000152D), UINT64_C(0x02C7E14AF6800000)},
+    uint128_t{UINT64_C(0x000000000000D3C2), UINT64_C(0x1BCECCEDA1000000)},
+    uint128_t{UINT64_C(0x0000000000084595), UINT64_C(0x161401484A000000)},
+    uint128_t{UINT64_C(0x000000000052B7D2), UINT64_C(0xDCC80CD2E4000000)},
+    uint128_t{UINT64_C(0x00000000033B2E3C), UINT64_C(0x9FD0803CE8000000)},
+    uint128_t{UINT64_C(0x00000000204FCE5E), UINT64_C(0x3E25026110000000)},
+    uint128_t{UINT64_C(0x00000001431E0FAE), UINT64_C(0x6D7217CAA0000000)},
+    uint128_t{UINT64_C(0x0000000C9F2C9CD0), UINT64_C(0x4674EDEA40000000)},
+    uint128_t{UINT64_C(0x0000007E37BE2022), UINT64_C(0xC0914B2680000000)},
+    uint128_t{UINT64_C(0x000004EE2D6D415B), UINT64_C(0x85ACEF8100000000)},
+    uint128_t{UINT64_C(0x0000314DC6448D93), UINT64_C(0x38C15B0A00000000)},
+    uint128_t{UINT64_C(0x0001ED09BEAD87C0), UINT64_C(0x378D8E6400000000)},
+    uint128_t{UINT64_C(0x0013426172C74D82), UINT64_C(0x2B878FE800000000)},
+    uint128_t{UINT64_C(0x00C097CE7BC90715), UINT64_C(0xB34B9F1000000000)},
+    uint128_t{UINT64_C(0x0785EE10D5DA46D9), UINT64_C(0x00F436A000000000)},
+    uint128_t{UINT64_C(0x4B3B4CA85A86C47A), UINT64_C(0x098A224000000000)}
+};
+
+// Indexed by countl_zero(x), the number of decimal digits of 2^bit_width(x) - 1, minus one.
+// Values with the same bit width span less than a factor of ten, so x has either this many
+// digits or one fewer, decided by comparing against pow10_u128 at this index.
+BOOST_INT128_INLINE_CONSTEXPR std::uint8_t ilog10_guess[129] = {
+    38, 38, 37, 37, 37, 37, 36, 36, 36, 35, 35, 35, 34, 34, 34, 34,
+    33, 33, 33, 32, 32, 32, 31, 31, 31, 31, 30, 30, 30, 29, 29, 29,
+    28, 28, 28, 27, 27, 27, 27, 26, 26, 26, 25, 25, 25, 24, 24, 24,
+    24, 23, 23, 23, 22, 22, 22, 21, 21, 21, 21, 20, 20, 20, 19, 19,
+    19, 18, 18, 18, 18, 17, 17, 17, 16, 16, 16, 15, 15, 15, 15, 14,
+    14, 14, 13, 13, 13, 12, 12, 12, 12, 11, 11, 11, 10, 10, 10,  9,
+     9,  9,  9,  8,  8,  8,  7,  7,  7,  6,  6,  6,  6,  5,  5,  5,
+     4,  4,  4,  3,  3,  3,  3,  2,  2,  2,  1,  1,  1,  0,  0,  0,
+     0
+};
+
+// Indexed by base, the largest power of each base from 2 to 36 that fits in 64 bits.
+// A value below it has at most base_chunk_digits digits in that base.
+BOOST_INT128_INLINE_CONSTEXPR std::uint64_t base_chunk_pow[37] = {
+    UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000), UINT64_C(0x8000000000000000),
+    UINT64_C(0xA8B8B452291FE821), UINT64_C(0x4000000000000000), UINT64_C(0x6765C793FA10079D),
+    UINT64_C(0x41C21CB8E1000000), UINT64_C(0x3642798750226111), UINT64_C(0x8000000000000000),
+    UINT64_C(0xA8B8B452291FE821), UINT64_C(0x8AC7230489E80000), UINT64_C(0x4D28CB56C33FA539),
+    UINT64_C(0x1ECA170C00000000), UINT64_C(0x780C7372621BD74D), UINT64_C(0x1E39A5057D810000),
+    UINT64_C(0x5B27AC993DF97701), UINT64_C(0x1000000000000000), UINT64_C(0x27B95E997E21D9F1),
+    UINT64_C(0x5DA0E1E53C5C8000), UINT64_C(0xD2AE3299C1C4AEDB), UINT64_C(0x16BCC41E90000000),
+    UINT64_C(0x2D04B7FDD9C0EF49), UINT64_C(0x5658597BCAA24000), UINT64_C(0xA0E2073737609371),
+    UINT64_C(0x0C29E98000000000), UINT64_C(0x14ADF4B7320334B9), UINT64_C(0x226ED36478BFA000),
+    UINT64_C(0x383D9170B85FF80B), UINT64_C(0x5A3C23E39C000000), UINT64_C(0x8E65137388122BCD),
+    UINT64_C(0xDD41BB36D259E000), UINT64_C(0x0AEE5720EE830681), UINT64_C(0x1000000000000000),
+    UINT64_C(0x172588AD4F5F0981), UINT64_C(0x211E44F7D02C1000), UINT64_C(0x2EE56725F06E5C71),
+    UINT64_C(0x41C21CB8E1000000)
+};
+
+BOOST_INT128_INLINE_CONSTEXPR std::uint8_t base_chunk_digits[37] = {
+     0,  0, 63, 40, 31, 27, 24, 22, 21, 20, 19, 18, 17, 17, 16, 16,
+    15, 15, 15, 15, 14, 14, 14, 14, 13, 13, 13, 13, 13, 13, 13, 12,
+    12, 12, 12, 12, 12
+};
+
+} // namespace detail
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_DETAIL_POW10_HPP
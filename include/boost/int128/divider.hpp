@@ -0,0 +1,664 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_DIVIDER_HPP
+#define BOOST_INT128_DIVIDER_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/bit.hpp>
+#include <boost/int128/numeric.hpp>
+#include <boost/int128/detail/config.hpp>
+#include <boost/int128/detail/common_mul.hpp>
+#include <boost/int128/detail/common_div.hpp>
+
+namespace boost {
+namespace int128 {
+
+// Division by a runtime invariant divisor using a precomputed multiplicative inverse
+// See: T. Granlund and P. Montgomery, Division by Invariant Integers using Multiplication, 1994
+// and the libdivide implementation by ridiculous_fish
+//
+// The branchfree variants trade one extra add and shift for the removal of all data dependent branches,
+// which is beneficial when the divider is selected at runtime from a set of dividers
+
+BOOST_INT128_EXPORT template <typename T, bool Branchfree = false>
+class divider;
+
+BOOST_INT128_EXPORT template <bool Branchfree>
+class divider<uint128_t, Branchfree>
+{
+private:
+
+    uint128_t divisor_ {};
+    uint128_t magic_ {};
+    int shift_ {};
+    bool add_indicator_ {};
+
+public:
+
+    explicit constexpr divider(const uint128_t d) noexcept : divisor_ {d}
+    {
+        BOOST_INT128_ASSERT_MSG(d != 0U, "Division by 0");
+        BOOST_INT128_IF_CONSTEXPR (Branchfree)
+        {
+            BOOST_INT128_ASSERT_MSG(d != 1U, "The branchfree divider does not support a divisor of 1");
+        }
+
+        const auto floor_log_2_d {127 - countl_zero(d)};
+
+        if (has_single_bit(d))
+        {
+            // Powers of 2 are a shift, which the branchfree algorithm also has to handle
+            magic_ = 0U;
+            shift_ = Branchfree ? floor_log_2_d - 1 : floor_log_2_d;
+            return;
+        }
+
+        uint128_t remainder {};
+        auto proposed_magic {detail::knuth_div_wide(uint128_t{1} << floor_log_2_d, uint128_t{0}, d, remainder)};
+        const auto e {d - remainder};
+
+        if (!Branchfree && e < (uint128_t{1} << floor_log_2_d))
+        {
+            // This power works
+            shift_ = floor_log_2_d;
+        }
+        else
+        {
+            // We need to go one bit higher which no longer fits, so we use the add indicator instead
+            proposed_magic += proposed_magic;
+            const auto twice_remainder {remainder + remainder};
+            if (twice_remainder >= d || twice_remainder < remainder)
+            {
+                ++proposed_magic;
+            }
+
+            shift_ = floor_log_2_d;
+            add_indicator_ = true;
+        }
+
+        magic_ = proposed_magic + 1U;
+    }
+
+    constexpr uint128_t divisor() const noexcept { return divisor_; }
+
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t divide(const uint128_t n) const noexcept
+    {
+        BOOST_INT128_IF_CONSTEXPR (Branchfree)
+        {
+            const auto q {detail::umulhi(magic_, n)};
+            return (((n - q) >> 1U) + q) >> shift_;
+        }
+        else
+        {
+            if (magic_ == 0U)
+            {
+                return n >> shift_;
+            }
+
+            const auto q {detail::umulhi(magic_, n)};
+            if (add_indicator_)
+            {
+                return (((n - q) >> 1U) + q) >> shift_;
+            }
+
+            return q >> shift_;
+        }
+    }
+
+    constexpr uint128_t remainder(const uint128_t n) const noexcept
+    {
+        return n - divide(n) * divisor_;
+    }
+
+    constexpr uint128_t divmod(const uint128_t n, uint128_t& remainder) const noexcept
+    {
+        const auto q {divide(n)};
+        remainder = n - q * divisor_;
+        return q;
+    }
+};
+
+BOOST_INT128_EXPORT template <bool Branchfree>
+class divider<int128_t, Branchfree>
+{
+private:
+
+    int128_t divisor_ {};
+    int128_t magic_ {};
+    int shift_ {};
+    bool add_indicator_ {};
+    bool negative_divisor_ {};
+
+public:
+
+    explicit constexpr divider(const int128_t d) noexcept : divisor_ {d}, negative_divisor_ {d < 0}
+    {
+        BOOST_INT128_ASSERT_MSG(d != 0, "Division by 0");
+
+        const auto abs_d {static_cast<uint128_t>(abs(d))};
+        const auto floor_log_2_d {127 - countl_zero(abs_d)};
+
+        if (has_single_bit(abs_d))
+        {
+            magic_ = 0;
+            shift_ = floor_log_2_d;
+            return;
+        }
+
+        uint128_t remainder {};
+        auto proposed_magic {detail::knuth_div_wide(uint128_t{1} << (floor_log_2_d - 1), uint128_t{0}, abs_d, remainder)};
+        const auto e {abs_d - remainder};
+
+        if (!Branchfree && e < (uint128_t{1} << floor_log_2_d))
+        {
+            // This power works
+            shift_ = floor_log_2_d - 1;
+        }
+        else
+        {
+            // We need to go one bit higher
+            // The magic number is then interpreted as negative which is fixed up by adding the numerator
+            proposed_magic += proposed_magic;
+            const auto twice_remainder {remainder + remainder};
+            if (twice_remainder >= abs_d || twice_remainder < remainder)
+            {
+                ++proposed_magic;
+            }
+
+            shift_ = floor_log_2_d;
+            add_indicator_ = true;
+        }
+
+        ++proposed_magic;
+        magic_ = static_cast<int128_t>(proposed_magic);
+
+        // The branchy algorithm folds the sign of the divisor into the magic number
+        BOOST_INT128_IF_CONSTEXPR (!Branchfree)
+        {
+            if (negative_divisor_)
+            {
+                magic_ = -magic_;
+            }
+        }
+    }
+
+    constexpr int128_t divisor() const noexcept { return divisor_; }
+
+    BOOST_INT128_FORCE_INLINE constexpr int128_t divide(const int128_t n) const noexcept
+    {
+        const auto sign {negative_divisor_ ? (std::numeric_limits<uint128_t>::max)() : uint128_t{0}};
+
+        BOOST_INT128_IF_CONSTEXPR (Branchfree)
+        {
+            const auto is_power_of_2 {magic_ == 0 ? 1U : 0U};
+            auto q {static_cast<uint128_t>(detail::smulhi(magic_, n)) + static_cast<uint128_t>(n)};
+
+            // Round towards zero for negative numerators
+            const auto q_sign {static_cast<uint128_t>(static_cast<int128_t>(q) >> 127)};
+            q += q_sign & ((uint128_t{1} << shift_) - is_power_of_2);
+            q = static_cast<uint128_t>(static_cast<int128_t>(q) >> shift_);
+
+            return static_cast<int128_t>((q ^ sign) - sign);
+        }
+        else
+        {
+            if (magic_ == 0)
+            {
+                const auto mask {(uint128_t{1} << shift_) - 1U};
+                const auto unsigned_q {static_cast<uint128_t>(n) + (static_cast<uint128_t>(n >> 127) & mask)};
+                const auto q {static_cast<uint128_t>(static_cast<int128_t>(unsigned_q) >> shift_)};
+
+                return static_cast<int128_t>((q ^ sign) - sign);
+            }
+
+            auto unsigned_q {static_cast<uint128_t>(detail::smulhi(magic_, n))};
+            if (add_indicator_)
+            {
+                unsigned_q += (static_cast<uint128_t>(n) ^ sign) - sign;
+            }
+
+            const auto q {static_cast<int128_t>(unsigned_q) >> shift_};
+
+            return q - (q >> 127);
+        }
+    }
+
+    constexpr int128_t remainder(const int128_t n) const noexcept
+    {
+        return n - divide(n) * divisor_;
+    }
+
+    constexpr int128_t divmod(const int128_t n, int128_t& remainder) const noexcept
+    {
+        const auto q {divide(n)};
+        remainder = n - q * divisor_;
+        return q;
+    }
+};
+
+BOOST_INT128_EXPORT using uint128_divider = divider<uint128_t>;
+BOOST_INT128_EXPORT using int128_divider = divider<int128_t>;
+BOOST_INT128_EXPORT using uint128_branchfree_divider = divider<uint128_t, true>;
+BOOST_INT128_EXPORT using int128_branchfree_divider = divider<int128_t, true>;
+
+BOOST_INT128_EXPORT template <typename T, bool Branchfree>
+constexpr T operator/(const T n, const divider<T, Branchfree>& d) noexcept
+{
+    return d.divide(n);
+}
+
+BOOST_INT128_EXPORT template <typename T, bool Branchfree>
+constexpr T operator%(const T n, const divider<T, Branchfree>& d) noexcept
+{
+    return d.remainder(n);
+}
+
+BOOST_INT128_EXPORT template <typename T, bool Branchfree>
+constexpr T& operator/=(T& n, const divider<T, Branchfree>& d) noexcept
+{
+    n = d.divide(n);
+    return n;
+}
+
+BOOST_INT128_EXPORT template <typename T, bool Branchfree>
+constexpr T& operator%=(T& n, const divider<T, Branchfree>& d) noexcept
+{
+    n = d.remainder(n);
+    return n;
+}
+
+namespace detail {
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+
+using constant_divisor_type = uint128_t;
+
+#else
+
+// Class types can not be used as non-type template parameters until C++20
+using constant_divisor_type = std::uint64_t;
+
+#endif
+
+} // namespace detail
+
+// Division by a compile time constant
+// The magic numbers are computed during compilation so the division reduces to a multiply-high, and a shift
+
+BOOST_INT128_EXPORT template <detail::constant_divisor_type Divisor>
+constexpr uint128_t div_by(const uint128_t x) noexcept
+{
+    static_assert(Divisor != 0U, "Division by 0");
+
+    constexpr divider<uint128_t> d {uint128_t{Divisor}};
+    return d.divide(x);
+}
+
+BOOST_INT128_EXPORT template <detail::constant_divisor_type Divisor>
+constexpr uint128_t mod_by(const uint128_t x) noexcept
+{
+    static_assert(Divisor != 0U, "Division by 0");
+
+    constexpr divider<uint128_t> d {uint128_t{Divisor}};
+    return d.remainder(x);
+}
+
+BOOST_INT128_EXPORT template <detail::constant_divisor_type Divisor>
+constexpr int128_t div_by(const int128_t x) noexcept
+{
+    // Dividing the magnitude truncates towards zero like the built-in operator
+    // Negating in the unsigned type keeps min / 1 well defined
+    const auto uq {div_by<Divisor>(static_cast<uint128_t>(abs(x)))};
+    return static_cast<int128_t>(x < 0 ? uint128_t{0} - uq : uq);
+}
+
+BOOST_INT128_EXPORT template <detail::constant_divisor_type Divisor>
+constexpr int128_t mod_by(const int128_t x) noexcept
+{
+    return static_cast<int128_t>(static_cast<uint128_t>(x) - static_cast<uint128_t>(div_by<Divisor>(x)) * uint128_t{Divisor});
+}
+
+namespace detail {
+
+// Below this size computing the magic numbers costs more than it saves
+BOOST_INT128_INLINE_CONSTEXPR std::size_t divide_n_threshold {16U};
+
+// Each loop computes four independent quotients before storing any of them,
+// so the latency of each division overlaps with the others.
+// This also means that in and out are allowed to be the same array.
+
+template <typename T>
+inline void divide_n_impl(const T* in, const std::size_t n, const T divisor, T* out) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(divisor == T{0}))
+    {
+        for (std::size_t i {}; i < n; ++i)
+        {
+            out[i] = T{0};
+        }
+        return;
+    }
+
+    if (n < divide_n_threshold)
+    {
+        for (std::size_t i {}; i < n; ++i)
+        {
+            out[i] = in[i] / divisor;
+        }
+        return;
+    }
+
+    const divider<T> d {divisor};
+
+    std::size_t i {};
+    for (; i + 4U <= n; i += 4U)
+    {
+        const auto q0 {d.divide(in[i])};
+        const auto q1 {d.divide(in[i + 1U])};
+        const auto q2 {d.divide(in[i + 2U])};
+        const auto q3 {d.divide(in[i + 3U])};
+
+        out[i] = q0;
+        out[i + 1U] = q1;
+        out[i + 2U] = q2;
+        out[i + 3U] = q3;
+    }
+    for (; i < n; ++i)
+    {
+        out[i] = d.divide(in[i]);
+    }
+}
+
+template <typename T>
+inline void divmod_n_impl(const T* in, const std::size_t n, const T divisor, T* quotients, T* remainders) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(divisor == T{0}))
+    {
+        for (std::size_t i {}; i < n; ++i)
+        {
+            if (quotients != nullptr)
+            {
+                quotients[i] = T{0};
+            }
+            remainders[i] = T{0};
+        }
+        return;
+    }
+
+    if (n < divide_n_threshold)
+    {
+        for (std::size_t i {}; i < n; ++i)
+        {
+            const auto value {in[i]};
+            const auto q {value / divisor};
+
+            if (quotients != nullptr)
+            {
+                quotients[i] = q;
+            }
+            remainders[i] = value - q * divisor;
+        }
+        return;
+    }
+
+    const divider<T> d {divisor};
+
+    std::size_t i {};
+    for (; i + 4U <= n; i += 4U)
+    {
+        const auto n0 {in[i]};
+        const auto n1 {in[i + 1U]};
+        const auto n2 {in[i + 2U]};
+        const auto n3 {in[i + 3U]};
+
+        const auto q0 {d.divide(n0)};
+        const auto q1 {d.divide(n1)};
+        const auto q2 {d.divide(n2)};
+        const auto q3 {d.divide(n3)};
+
+        if (quotients != nullptr)
+        {
+            quotients[i] = q0;
+            quotients[i + 1U] = q1;
+            quotients[i + 2U] = q2;
+            quotients[i + 3U] = q3;
+        }
+
+        remainders[i] = n0 - q0 * divisor;
+        remainders[i + 1U] = n1 - q1 * divisor;
+        remainders[i + 2U] = n2 - q2 * divisor;
+        remainders[i + 3U] = n3 - q3 * divisor;
+    }
+    for (; i < n; ++i)
+    {
+        const auto value {in[i]};
+        const auto q {d.divide(value)};
+
+        if (quotients != nullptr)
+        {
+            quotients[i] = q;
+        }
+        remainders[i] = value - q * divisor;
+    }
+}
+
+// Divisors that fit in one limb reuse a single reciprocal for every element,
+// which is two multiplications per limb of the dividend instead of the 128-bit magic multiply.
+// Either of quotients and remainders may be nullptr.
+inline void divmod_n_one_limb(const uint128_t* in, const std::size_t n, const std::uint64_t divisor,
+                              uint128_t* quotients, uint128_t* remainders) noexcept
+{
+    BOOST_INT128_ASSUME(divisor != 0U); // LCOV_EXCL_LINE
+
+    const auto s {countl_zero(divisor)};
+    const auto complement_s {64 - s};
+    const auto d {divisor << s};
+    const auto v {impl::reciprocal_word(d)};
+
+    const auto divide_one {[&](const uint128_t value, std::uint64_t& r) noexcept {
+        const auto u2 {s == 0 ? UINT64_C(0) : value.high >> complement_s};
+        const auto u1 {s == 0 ? value.high : (value.high << s) | (value.low >> complement_s)};
+        const auto u0 {value.low << s};
+
+        const auto q1 {impl::div_2by1(u2, u1, d, v, r)};
+        const auto q0 {impl::div_2by1(r, u0, d, v, r)};
+        r >>= s;
+
+        return uint128_t{q1, q0};
+    }};
+
+    std::size_t i {};
+    for (; i + 4U <= n; i += 4U)
+    {
+        std::uint64_t r[4] {};
+
+        const auto q0 {divide_one(in[i], r[0])};
+        const auto q1 {divide_one(in[i + 1U], r[1])};
+        const auto q2 {divide_one(in[i + 2U], r[2])};
+        const auto q3 {divide_one(in[i + 3U], r[3])};
+
+        if (quotients != nullptr)
+        {
+            quotients[i] = q0;
+            quotients[i + 1U] = q1;
+            quotients[i + 2U] = q2;
+            quotients[i + 3U] = q3;
+        }
+        if (remainders != nullptr)
+        {
+            remainders[i] = r[0];
+            remainders[i + 1U] = r[1];
+            remainders[i + 2U] = r[2];
+            remainders[i + 3U] = r[3];
+        }
+    }
+    for (; i < n; ++i)
+    {
+        std::uint64_t r {};
+        const auto q {divide_one(in[i], r)};
+
+        if (quotients != nullptr)
+        {
+            quotients[i] = q;
+        }
+        if (remainders != nullptr)
+        {
+            remainders[i] = r;
+        }
+    }
+}
+
+template <typename T>
+inline void divide_n_impl(const T* lhs, const T* rhs, const std::size_t n, T* out) noexcept
+{
+    std::size_t i {};
+    for (; i + 4U <= n; i += 4U)
+    {
+        const auto q0 {lhs[i] / rhs[i]};
+        const auto q1 {lhs[i + 1U] / rhs[i + 1U]};
+        const auto q2 {lhs[i + 2U] / rhs[i + 2U]};
+        const auto q3 {lhs[i + 3U] / rhs[i + 3U]};
+
+        out[i] = q0;
+        out[i + 1U] = q1;
+        out[i + 2U] = q2;
+        out[i + 3U] = q3;
+    }
+    for (; i < n; ++i)
+    {
+        out[i] = lhs[i] / rhs[i];
+    }
+}
+
+template <typename T>
+inline void divmod_n_impl(const T* lhs, const T* rhs, const std::size_t n, T* quotients, T* remainders) noexcept
+{
+    // Only one division per element, the remainder is recovered with a multiplication
+    // A divisor of 0 gives 0 for both results to match the operators
+    std::size_t i {};
+    for (; i + 4U <= n; i += 4U)
+    {
+        T q[4] {};
+        T r[4] {};
+
+        for (std::size_t j {}; j < 4U; ++j)
+        {
+            const auto divisor {rhs[i + j]};
+            q[j] = lhs[i + j] / divisor;
+            r[j] = divisor == T{0} ? T{0} : lhs[i + j] - q[j] * divisor;
+        }
+
+        for (std::size_t j {}; j < 4U; ++j)
+        {
+            if (quotients != nullptr)
+            {
+                quotients[i + j] = q[j];
+            }
+            remainders[i + j] = r[j];
+        }
+    }
+    for (; i < n; ++i)
+    {
+        const auto divisor {rhs[i]};
+        const auto q {lhs[i] / divisor};
+        const auto r {divisor == T{0} ? T{0} : lhs[i] - q * divisor};
+
+        if (quotients != nullptr)
+        {
+            quotients[i] = q;
+        }
+        remainders[i] = r;
+    }
+}
+
+} // namespace detail
+
+// Batched division of n values by a single divisor
+// Large batches use a divider so that no division instructions are issued inside the loop
+
+BOOST_INT128_EXPORT inline void divide_n(const uint128_t* in, const std::size_t n, const uint128_t divisor, uint128_t* out) noexcept
+{
+    if (divisor.high == 0U && divisor.low != 0U && n >= detail::divide_n_threshold)
+    {
+        detail::divmod_n_one_limb(in, n, divisor.low, out, nullptr);
+        return;
+    }
+
+    detail::divide_n_impl(in, n, divisor, out);
+}
+
+BOOST_INT128_EXPORT inline void divide_n(const int128_t* in, const std::size_t n, const int128_t divisor, int128_t* out) noexcept
+{
+    detail::divide_n_impl(in, n, divisor, out);
+}
+
+BOOST_INT128_EXPORT inline void remainder_n(const uint128_t* in, const std::size_t n, const uint128_t divisor, uint128_t* out) noexcept
+{
+    if (divisor.high == 0U && divisor.low != 0U && n >= detail::divide_n_threshold)
+    {
+        detail::divmod_n_one_limb(in, n, divisor.low, nullptr, out);
+        return;
+    }
+
+    detail::divmod_n_impl(in, n, divisor, static_cast<uint128_t*>(nullptr), out);
+}
+
+BOOST_INT128_EXPORT inline void remainder_n(const int128_t* in, const std::size_t n, const int128_t divisor, int128_t* out) noexcept
+{
+    detail::divmod_n_impl(in, n, divisor, static_cast<int128_t*>(nullptr), out);
+}
+
+BOOST_INT128_EXPORT inline void divmod_n(const uint128_t* in, const std::size_t n, const uint128_t divisor, uint128_t* quotients, uint128_t* remainders) noexcept
+{
+    if (divisor.high == 0U && divisor.low != 0U && n >= detail::divide_n_threshold)
+    {
+        detail::divmod_n_one_limb(in, n, divisor.low, quotients, remainders);
+        return;
+    }
+
+    detail::divmod_n_impl(in, n, divisor, quotients, remainders);
+}
+
+BOOST_INT128_EXPORT inline void divmod_n(const int128_t* in, const std::size_t n, const int128_t divisor, int128_t* quotients, int128_t* remainders) noexcept
+{
+    detail::divmod_n_impl(in, n, divisor, quotients, remainders);
+}
+
+// Element-wise division of lhs[i] by rhs[i]
+
+BOOST_INT128_EXPORT inline void divide_n(const uint128_t* lhs, const uint128_t* rhs, const std::size_t n, uint128_t* out) noexcept
+{
+    detail::divide_n_impl(lhs, rhs, n, out);
+}
+
+BOOST_INT128_EXPORT inline void divide_n(const int128_t* lhs, const int128_t* rhs, const std::size_t n, int128_t* out) noexcept
+{
+    detail::divide_n_impl(lhs, rhs, n, out);
+}
+
+BOOST_INT128_EXPORT inline void remainder_n(const uint128_t* lhs, const uint128_t* rhs, const std::size_t n, uint128_t* out) noexcept
+{
+    detail::divmod_n_impl(lhs, rhs, n, static_cast<uint128_t*>(nullptr), out);
+}
+
+BOOST_INT128_EXPORT inline void remainder_n(const int128_t* lhs, const int128_t* rhs, const std::size_t n, int128_t* out) noexcept
+{
+    detail::divmod_n_impl(lhs, rhs, n, static_cast<int128_t*>(nullptr), out);
+}
+
+BOOST_INT128_EXPORT inline void divmod_n(const uint128_t* lhs, const uint128_t* rhs, const std::size_t n, uint128_t* quotients, uint128_t* remainders) noexcept
+{
+    detail::divmod_n_impl(lhs, rhs, n, quotients, remainders);
+}
+
+BOOST_INT128_EXPORT inline void divmod_n(const int128_t* lhs, const int128_t* rhs, const std::size_t n, int128_t* quotients, int128_t* remainders) noexcept
+{
+    detail::divmod_n_impl(lhs, rhs, n, quotients, remainders);
+}
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_DIVIDER_HPP
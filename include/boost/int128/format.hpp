@@ -0,0 +1,382 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Formatter specializations for std::format when the standard library provides it,
+// and for {fmt} when it can be found.
+
+#ifndef BOOST_INT128_FORMAT_HPP
+#define BOOST_INT128_FORMAT_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/detail/mini_to_chars.hpp>
+#include <boost/int128/detail/format_field.hpp>
+#include <boost/int128/detail/config.hpp>
+
+#if (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)) && __has_include(<format>)
+#  include <format>
+#  if defined(__cpp_lib_format) && __cpp_lib_format >= 201907L
+#    define BOOST_INT128_HAS_FORMAT
+#  endif
+#endif
+
+#if __has_include(<fmt/format.h>)
+#  include <fmt/format.h>
+#  define BOOST_INT128_HAS_FMT_FORMAT
+#endif
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstddef>
+#include <cstdint>
+
+#endif
+
+namespace boost {
+namespace int128 {
+namespace detail {
+
+// The standard format specification for integers:
+// [[fill]align][sign][#][0][width][type] with type one of b, B, d, o, x and X
+struct format_spec
+{
+    char fill {' '};
+    char align {'\0'};
+    char sign {'-'};
+    bool alternate {false};
+    bool zero_pad {false};
+    int width {0};
+    char type {'d'};
+};
+
+constexpr bool is_format_align(const char c) noexcept
+{
+    return c == '<' || c == '>' || c == '^';
+}
+
+// Parses the specification at the start of [first, last), returning the position of the closing brace.
+// Errors go to ErrorHandler::report, which throws the exception of the formatting library.
+template <typename ErrorHandler, typename Iterator>
+constexpr Iterator parse_format_spec(Iterator first, const Iterator last, format_spec& spec)
+{
+    if (first == last || *first == '}')
+    {
+        return first;
+    }
+
+    auto next {first};
+    ++next;
+    if (next != last && is_format_align(*next))
+    {
+        if (*first == '{')
+        {
+            ErrorHandler::report("Invalid fill character");
+        }
+
+        spec.fill = *first;
+        spec.align = *next;
+        first = ++next;
+    }
+    else if (is_format_align(*first))
+    {
+        spec.align = *first;
+        ++first;
+    }
+
+    if (first != last && (*first == '+' || *first == '-' || *first == ' '))
+    {
+        spec.sign = *first;
+        ++first;
+    }
+
+    if (first != last && *first == '#')
+    {
+        spec.alternate = true;
+        ++first;
+    }
+
+    if (first != last && *first == '0')
+    {
+        spec.zero_pad = true;
+        ++first;
+    }
+
+    while (first != last && *first >= '0' && *first <= '9')
+    {
+        if (spec.width > (INT32_MAX - 9) / 10)
+        {
+            ErrorHandler::report("Width is too large");
+        }
+
+        spec.width = spec.width * 10 + (*first - '0');
+        ++first;
+    }
+
+    if (first != last && *first == '{')
+    {
+        ErrorHandler::report("Dynamic width is not supported");
+    }
+    if (first != last && *first == '.')
+    {
+        ErrorHandler::report("Precision is not allowed for integers");
+    }
+    if (first != last && *first == 'L')
+    {
+        ErrorHandler::report("Locale specific formatting is not supported");
+    }
+
+    if (first != last && *first != '}')
+    {
+        switch (*first)
+        {
+            case 'b':
+            case 'B':
+            case 'd':
+            case 'o':
+            case 'x':
+            case 'X':
+                spec.type = *first;
+                ++first;
+                break;
+            default:
+                ErrorHandler::report("Invalid type for a 128-bit integer");
+        }
+    }
+
+    if (first != last && *first != '}')
+    {
+        ErrorHandler::report("Invalid format specification");
+    }
+
+    return first;
+}
+
+// Copies one character at a time, for output iterators without a faster way
+struct format_copy
+{
+    template <typename OutputIt>
+    OutputIt operator()(OutputIt out, const char* first, const char* last) const
+    {
+        while (first != last)
+        {
+            *out++ = *first++;
+        }
+
+        return out;
+    }
+};
+
+template <typename OutputIt, typename Copy>
+OutputIt format_fill(OutputIt out, std::int32_t count, const char c, Copy copy)
+{
+    char block[64] {};
+    for (auto& b : block)
+    {
+        b = c;
+    }
+
+    while (count > 0)
+    {
+        const auto n {count < 64 ? count : 64};
+        out = copy(out, block, block + n);
+        count -= n;
+    }
+
+    return out;
+}
+
+// Writes the padded sign, base prefix and digits as contiguous pieces through copy
+template <typename OutputIt, typename Copy>
+OutputIt format_integer(OutputIt out, const uint128_t magnitude, const bool negative, const format_spec& spec, Copy copy)
+{
+    int base {10};
+    switch (spec.type)
+    {
+        case 'b':
+        case 'B':
+            base = 2;
+            break;
+        case 'o':
+            base = 8;
+            break;
+        case 'x':
+        case 'X':
+            base = 16;
+            break;
+        default:
+            break;
+    }
+
+    char sign {'\0'};
+    if (negative)
+    {
+        sign = '-';
+    }
+    else if (spec.sign != '-')
+    {
+        sign = spec.sign;
+    }
+
+    char prefix[3] {};
+    if (spec.alternate && base != 10)
+    {
+        // Octal only gets its leading zero when there is not already one
+        if (base != 8)
+        {
+            prefix[0] = '0';
+            prefix[1] = spec.type;
+        }
+        else if (magnitude != 0U)
+        {
+            prefix[0] = '0';
+        }
+    }
+
+    char buffer[max_field_chars] {};
+    char* digits {};
+    const auto last {write_integer_field(buffer, magnitude, sign, prefix, base, spec.type == 'X', digits)};
+
+    // Zeros go between the sign and prefix and the digits, and only without an alignment
+    const auto zero_pad {spec.align == '\0' && spec.zero_pad};
+    const auto fill {zero_pad ? '0' : spec.fill};
+
+    auto align {field_align::right};
+    if (zero_pad)
+    {
+        align = field_align::internal;
+    }
+    else if (spec.align == '<')
+    {
+        align = field_align::left;
+    }
+    else if (spec.align == '^')
+    {
+        align = field_align::center;
+    }
+
+    write_padded(buffer, digits, last, spec.width, align,
+                 [&](const char* first, const char* piece_last) {
+                     out = copy(out, first, piece_last);
+                     return true;
+                 },
+                 [&](const std::ptrdiff_t count) {
+                     out = format_fill(out, static_cast<std::int32_t>(count), fill, copy);
+                     return true;
+                 });
+
+    return out;
+}
+
+template <typename OutputIt, typename T, typename Copy>
+OutputIt format_integer(OutputIt out, const T value, const format_spec& spec, Copy copy)
+{
+    return format_integer(out, unsigned_magnitude(value), is_negative(value), spec, copy);
+}
+
+} // namespace detail
+} // namespace int128
+} // namespace boost
+
+#ifdef BOOST_INT128_HAS_FORMAT
+
+namespace boost {
+namespace int128 {
+namespace detail {
+
+struct std_format_error_handler
+{
+    static void report(const char* message)
+    {
+        throw std::format_error(message);
+    }
+};
+
+template <typename T>
+struct std_formatter
+{
+    format_spec spec_ {};
+
+    template <typename ParseContext>
+    constexpr auto parse(ParseContext& ctx)
+    {
+        return parse_format_spec<std_format_error_handler>(ctx.begin(), ctx.end(), spec_);
+    }
+
+    template <typename FormatContext>
+    auto format(const T value, FormatContext& ctx) const
+    {
+        return format_integer(ctx.out(), value, spec_, format_copy {});
+    }
+};
+
+} // namespace detail
+} // namespace int128
+} // namespace boost
+
+namespace std {
+
+template <>
+struct formatter<boost::int128::uint128_t> : boost::int128::detail::std_formatter<boost::int128::uint128_t> {};
+
+template <>
+struct formatter<boost::int128::int128_t> : boost::int128::detail::std_formatter<boost::int128::int128_t> {};
+
+} // namespace std
+
+#endif // BOOST_INT128_HAS_FORMAT
+
+#ifdef BOOST_INT128_HAS_FMT_FORMAT
+
+namespace boost {
+namespace int128 {
+namespace detail {
+
+struct fmt_format_error_handler
+{
+    static void report(const char* message)
+    {
+        FMT_THROW(fmt::format_error(message));
+    }
+};
+
+template <typename T>
+struct fmt_formatter
+{
+    format_spec spec_ {};
+
+    template <typename ParseContext>
+    constexpr auto parse(ParseContext& ctx) -> decltype(ctx.begin())
+    {
+        return parse_format_spec<fmt_format_error_handler>(ctx.begin(), ctx.end(), spec_);
+    }
+
+    // Writing each piece as a string lets {fmt} append it at once instead of per character
+    template <typename FormatContext>
+    auto format(const T value, FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        const auto copy = [&ctx](decltype(ctx.out()) out, const char* first, const char* last) {
+            ctx.advance_to(out);
+            return fmt::formatter<fmt::string_view>{}.format(fmt::string_view(first, static_cast<std::size_t>(last - first)), ctx);
+        };
+
+        return format_integer(ctx.out(), value, spec_, copy);
+    }
+};
+
+} // namespace detail
+} // namespace int128
+} // namespace boost
+
+namespace fmt {
+
+template <>
+struct formatter<boost::int128::uint128_t> : boost::int128::detail::fmt_formatter<boost::int128::uint128_t> {};
+
+template <>
+struct formatter<boost::int128::int128_t> : boost::int128::detail::fmt_formatter<boost::int128::int128_t> {};
+
+} // namespace fmt
+
+#endif // BOOST_INT128_HAS_FMT_FORMAT
+
+#endif // BOOST_INT128_FORMAT_HPP
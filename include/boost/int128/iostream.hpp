@@ -8,7 +8,8 @@
 #include <boost/int128/int128.hpp>
 #include <boost/int128/detail/mini_from_chars.hpp>
 #include <boost/int128/detail/mini_to_chars.hpp>
-#include <boost/int128/detail/utilities.hpp>
+#include <boost/int128/detail/format_field.hpp>
+#include <boost/int128/numeric.hpp>
 #include <boost/int128/detail/config.hpp>
 
 #ifndef BOOST_INT128_BUILD_MODULE
@@ -16,7 +17,9 @@
 #include <type_traits>
 #include <iostream>
 #include <iomanip>
-#include <cstring>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
 
 #endif
 
@@ -34,108 +37,262 @@ struct streamable_overload
 template <typename T>
 static constexpr bool is_streamable_overload_v = streamable_overload<T>::value;
 
-} // namespace detail
+inline int stream_base(const std::ios_base::fmtflags flags) noexcept
+{
+    switch (flags & std::ios_base::basefield)
+    {
+        case std::ios_base::oct:
+            return 8;
+        case std::ios_base::hex:
+            return 16;
+        case std::ios_base::dec:
+            return 10;
+        default:
+            // Without a base the prefix of the input decides, as in std::num_get
+            return 0;
+    }
+}
 
-BOOST_INT128_EXPORT template <typename charT, typename traits, typename LibIntegerType>
-auto operator>>(std::basic_istream<charT, traits>& is, LibIntegerType& v)
-    -> std::enable_if_t<detail::is_streamable_overload_v<LibIntegerType>, std::basic_istream<charT, traits>&>
+template <typename charT, typename traits>
+char stream_narrow(const std::basic_ios<charT, traits>& ios, const typename traits::int_type c)
+{
+    return traits::eq_int_type(c, traits::eof()) ? '\0' : ios.narrow(traits::to_char_type(c), '\0');
+}
+
+// Reads digits straight from the stream buffer, starting at the current character c.
+// Digits are gathered in chunks that fit a 64-bit word as in parse_magnitude.
+// Returns the first character after the digits, which is left in the buffer.
+template <typename charT, typename traits>
+typename traits::int_type stream_magnitude(const std::basic_ios<charT, traits>& ios, std::basic_streambuf<charT, traits>* buf,
+                                           typename traits::int_type c, const int base, uint128_t& magnitude, bool& overflow, bool& any_digits)
 {
-    charT t_buffer[64] {};
-    is >> std::ws >> std::setw(63) >> t_buffer;
+    const auto unsigned_base {static_cast<std::uint64_t>(base)};
+    const auto chunk_digits {static_cast<std::ptrdiff_t>(base_chunk_digits[base])};
 
-    char buffer[64] {};
-    auto buffer_start {buffer};
+    uint128_t result {};
+    bool overflowed {false};
+    bool partial_chunk {false};
 
-    BOOST_INT128_IF_CONSTEXPR (!std::is_same<charT, char>::value)
+    while (!partial_chunk)
     {
-        auto first {buffer};
-        auto t_first {t_buffer};
-        const auto t_buffer_end {t_buffer + detail::strlen(t_buffer)};
+        std::uint64_t chunk {};
+        std::ptrdiff_t count {};
+        while (count < chunk_digits)
+        {
+            const auto digit {static_cast<std::uint64_t>(impl::digit_from_char(stream_narrow(ios, c)))};
+            if (digit >= unsigned_base)
+            {
+                partial_chunk = true;
+                break;
+            }
+
+            chunk = chunk * unsigned_base + digit;
+            ++count;
+            c = buf->snextc();
+        }
 
-        while (t_first != t_buffer_end)
+        if (count == 0)
         {
-            *first++ = static_cast<char>(*t_first++);
+            break;
         }
+
+        append_chunk(result, overflowed, chunk, base, count);
+        any_digits = true;
     }
-    else
+
+    magnitude = result;
+    overflow = overflowed;
+
+    return c;
+}
+
+template <typename charT, typename traits>
+bool stream_write(std::basic_streambuf<charT, traits>* buf, const std::basic_ios<charT, traits>& ios, const char* first, const char* last)
+{
+    charT wide[max_field_chars] {};
+    auto p {wide};
+    while (first != last)
+    {
+        *p++ = ios.widen(*first++);
+    }
+
+    return buf->sputn(wide, p - wide) == p - wide;
+}
+
+// Narrow streams take the formatted characters as they are
+template <typename traits>
+bool stream_write(std::basic_streambuf<char, traits>* buf, const std::basic_ios<char, traits>&, const char* first, const char* last)
+{
+    return buf->sputn(first, last - first) == last - first;
+}
+
+template <typename charT, typename traits>
+bool stream_fill(std::basic_streambuf<charT, traits>* buf, const charT fill, std::ptrdiff_t count)
+{
+    for (; count > 0; --count)
+    {
+        if (traits::eq_int_type(buf->sputc(fill), traits::eof()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace detail
+
+// Reads an optional '-' for int128_t, an optional base prefix for hex and oct, and then digits,
+// directly from the stream buffer. Sets failbit when there are no digits or the value is out of range,
+// in which case v is left unmodified.
+BOOST_INT128_EXPORT template <typename charT, typename traits, typename LibIntegerType>
+auto operator>>(std::basic_istream<charT, traits>& is, LibIntegerType& v)
+    -> std::enable_if_t<detail::is_streamable_overload_v<LibIntegerType>, std::basic_istream<charT, traits>&>
+{
+    // Skips leading whitespace unless noskipws is set
+    const typename std::basic_istream<charT, traits>::sentry sentry {is};
+    if (!sentry)
     {
-        std::memcpy(buffer, t_buffer, sizeof(t_buffer));
+        return is;
     }
 
-    const auto flags {is.flags()};
-    int base {10};
-    if (flags & std::ios_base::oct)
+    const auto buf {is.rdbuf()};
+    auto c {buf->sgetc()};
+
+    bool is_negative {false};
+    BOOST_INT128_IF_CONSTEXPR (std::numeric_limits<LibIntegerType>::is_signed)
     {
-        base = 8;
-        if (*buffer_start == '0')
+        if (detail::stream_narrow(is, c) == '-')
         {
-            ++buffer_start;
+            is_negative = true;
+            c = buf->snextc();
         }
     }
-    else if (flags & std::ios_base::hex)
+
+    auto base {detail::stream_base(is.flags())};
+
+    // A leading zero is a digit of its own unless an x follows it
+    bool leading_zero {false};
+    if (base != 10 && detail::stream_narrow(is, c) == '0')
     {
-        base = 16;
-        if (*buffer_start == '0')
+        c = buf->snextc();
+        const auto next {detail::stream_narrow(is, c)};
+        if (base != 8 && (next == 'x' || next == 'X'))
+        {
+            base = 16;
+            c = buf->snextc();
+        }
+        else
         {
-            buffer_start += 2;
+            leading_zero = true;
+            if (base == 0)
+            {
+                base = 8;
+            }
         }
     }
 
-    detail::from_chars(buffer_start, buffer + detail::strlen(buffer), v, base);
+    if (base == 0)
+    {
+        base = 10;
+    }
+
+    uint128_t magnitude {};
+    bool overflow {false};
+    bool any_digits {leading_zero};
+    c = detail::stream_magnitude(is, buf, c, base, magnitude, overflow, any_digits);
+
+    auto state {std::ios_base::goodbit};
+    if (traits::eq_int_type(c, traits::eof()))
+    {
+        state |= std::ios_base::eofbit;
+    }
+
+    // The magnitude of the minimum value is one more than that of the maximum
+    const auto limit {static_cast<uint128_t>((std::numeric_limits<LibIntegerType>::max)()) + static_cast<unsigned>(is_negative)};
+    if (!any_digits || overflow || magnitude > limit)
+    {
+        state |= std::ios_base::failbit;
+    }
+    else
+    {
+        v = static_cast<LibIntegerType>(is_negative ? uint128_t{0} - magnitude : magnitude);
+    }
+
+    is.setstate(state);
 
     return is;
 }
 
+// Writes the sign, the base prefix with showbase, and the digits directly to the stream buffer,
+// padded with fill to width according to adjustfield
 BOOST_INT128_EXPORT template <typename charT, typename traits, typename LibIntegerType>
 auto operator<<(std::basic_ostream<charT, traits>& os, const LibIntegerType& v)
     -> std::enable_if_t<detail::is_streamable_overload_v<LibIntegerType>, std::basic_ostream<charT, traits>&>
 {
-    char buffer[64U] {};
+    const typename std::basic_ostream<charT, traits>::sentry sentry {os};
+    if (!sentry)
+    {
+        return os;
+    }
 
     const auto flags {os.flags()};
-    int base {10};
-    bool uppercase {false};
-    if (flags & std::ios_base::oct)
+    auto base {detail::stream_base(flags)};
+    if (base == 0)
     {
-        base = 8;
+        base = 10;
     }
-    else if (flags & std::ios_base::hex)
+
+    const auto uppercase {(flags & std::ios_base::uppercase) != 0};
+    const auto magnitude {detail::unsigned_magnitude(v)};
+
+    char sign {'\0'};
+    if (detail::is_negative(v))
     {
-        base = 16;
+        sign = '-';
+    }
+    else if (std::numeric_limits<LibIntegerType>::is_signed && base == 10 && (flags & std::ios_base::showpos))
+    {
+        sign = '+';
     }
 
-    if (flags & std::ios_base::uppercase)
+    // As with the builtin types zero has no prefix
+    const char* prefix {""};
+    if ((flags & std::ios_base::showbase) && base != 10 && magnitude != 0U)
     {
-        uppercase = true;
+        prefix = base == 8 ? "0" : uppercase ? "0X" : "0x";
     }
 
-    auto first {detail::mini_to_chars(buffer, v, base, uppercase)};
+    char buffer[detail::max_field_chars] {};
+    char* digits {};
+    const auto last {detail::write_integer_field(buffer, magnitude, sign, prefix, base, uppercase, digits)};
 
-    if (base == 8)
+    const auto adjust {flags & std::ios_base::adjustfield};
+    auto align {detail::field_align::right};
+    if (adjust == std::ios_base::left)
     {
-        *--first = '0';
+        align = detail::field_align::left;
     }
-    else if (base == 16)
+    else if (adjust == std::ios_base::internal)
     {
-        *--first = uppercase ? 'X' : 'x';
-        *--first = '0';
+        align = detail::field_align::internal;
     }
 
-    BOOST_INT128_IF_CONSTEXPR (!std::is_same<charT, char>::value)
-    {
-        charT t_buffer[64U] {};
+    const auto buf {os.rdbuf()};
+    const auto fill {os.fill()};
+    const auto ok {detail::write_padded(buffer, digits, last, static_cast<std::ptrdiff_t>(os.width()), align,
+                                        [&](const char* first, const char* piece_last) {
+                                            return detail::stream_write(buf, os, first, piece_last);
+                                        },
+                                        [&](const std::ptrdiff_t count) {
+                                            return detail::stream_fill(buf, fill, count);
+                                        })};
 
-        auto t_first {t_buffer};
-        while (*first != '\0')
-        {
-            *t_first++ = static_cast<charT>(*first++);
-        }
+    os.width(0);
 
-        os << t_buffer;
-    }
-    else
+    if (!ok)
     {
-        os << first;
+        os.setstate(std::ios_base::badbit);
     }
 
     return os;
@@ -7,12 +7,19 @@
 
 #include <boost/int128/bit.hpp>
 #include <boost/int128/detail/traits.hpp>
+#include <boost/int128/detail/common_mul.hpp>
+#include <boost/int128/detail/common_div.hpp>
 
 #ifndef BOOST_INT128_BUILD_MODULE
 
 #include <limits>
 #include <iostream>
 #include <limits>
+#include <iterator>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
 
 #endif
 
@@ -54,144 +61,383 @@ BOOST_INT128_INLINE_CONSTEXPR bool is_reduced_integer_v {reduced_integers<Intege
 
 } // namespace detail
 
-BOOST_INT128_EXPORT constexpr uint128_t add_sat(const uint128_t x, const uint128_t y) noexcept
+// Checked arithmetic in the style of C23 <stdckdint.h>
+// The wrapped result is always stored, and the return value is true if and only if the
+// mathematical result does not fit in the type. The flags are computed from the carry chains
+// without branches so that the saturating functions below compile to conditional moves.
+
+BOOST_INT128_EXPORT constexpr bool ckd_add(uint128_t* result, const uint128_t x, const uint128_t y) noexcept
 {
-    const auto z {x + y};
+    #if defined(BOOST_INT128_HAS_INT128) && defined(BOOST_INT128_HAS_BUILTIN_ADD_OVERFLOW)
 
-    if (z < x)
-    {
-        return (std::numeric_limits<uint128_t>::max)();
-    }
+    detail::builtin_u128 res {};
+    const auto overflow {__builtin_add_overflow(static_cast<detail::builtin_u128>(x), static_cast<detail::builtin_u128>(y), &res)};
+    *result = static_cast<uint128_t>(res);
+
+    return overflow;
+
+    #else
 
-    return z;
+    const auto res {x + y};
+    *result = res;
+
+    return res < x;
+
+    #endif
 }
 
-BOOST_INT128_EXPORT constexpr uint128_t sub_sat(const uint128_t x, const uint128_t y) noexcept
+BOOST_INT128_EXPORT constexpr bool ckd_add(int128_t* result, const int128_t x, const int128_t y) noexcept
 {
-    const auto z {x - y};
+    #if defined(BOOST_INT128_HAS_INT128) && defined(BOOST_INT128_HAS_BUILTIN_ADD_OVERFLOW)
 
-    if (z > x)
-    {
-        return (std::numeric_limits<uint128_t>::min)();
-    }
+    detail::builtin_i128 res {};
+    const auto overflow {__builtin_add_overflow(static_cast<detail::builtin_i128>(x), static_cast<detail::builtin_i128>(y), &res)};
+    *result = static_cast<int128_t>(res);
+
+    return overflow;
+
+    #else
+
+    // Overflow occurs when both operands have the same sign, and the result has the other sign
+    const auto res {static_cast<int128_t>(static_cast<uint128_t>(x) + static_cast<uint128_t>(y))};
+    *result = res;
 
-    return z;
+    return ((x.high ^ res.high) & (y.high ^ res.high)) < 0;
+
+    #endif
 }
 
-constexpr int128_t add_sat(int128_t x, int128_t y) noexcept;
-constexpr int128_t sub_sat(int128_t x, int128_t y) noexcept;
+BOOST_INT128_EXPORT constexpr bool ckd_sub(uint128_t* result, const uint128_t x, const uint128_t y) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128) && defined(BOOST_INT128_HAS_BUILTIN_SUB_OVERFLOW)
 
-#ifdef _MSC_VER
-#  pragma warning(push)
-#  pragma warning(disable : 4307) // Addition Overflow
-#  pragma warning(disable : 4146) // Unary minus applied to unsigned type
-#endif
+    detail::builtin_u128 res {};
+    const auto overflow {__builtin_sub_overflow(static_cast<detail::builtin_u128>(x), static_cast<detail::builtin_u128>(y), &res)};
+    *result = static_cast<uint128_t>(res);
+
+    return overflow;
+
+    #else
+
+    *result = x - y;
+
+    return x < y;
+
+    #endif
+}
+
+BOOST_INT128_EXPORT constexpr bool ckd_sub(int128_t* result, const int128_t x, const int128_t y) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128) && defined(BOOST_INT128_HAS_BUILTIN_SUB_OVERFLOW)
+
+    detail::builtin_i128 res {};
+    const auto overflow {__builtin_sub_overflow(static_cast<detail::builtin_i128>(x), static_cast<detail::builtin_i128>(y), &res)};
+    *result = static_cast<int128_t>(res);
+
+    return overflow;
+
+    #else
+
+    // Overflow occurs when the operands have different signs, and the result does not have the sign of x
+    const auto res {static_cast<int128_t>(static_cast<uint128_t>(x) - static_cast<uint128_t>(y))};
+    *result = res;
+
+    return ((x.high ^ y.high) & (x.high ^ res.high)) < 0;
+
+    #endif
+}
+
+namespace detail {
+
+// The product is assembled from the 64-bit halves, so at most three 64 x 64 -> 128 multiplications are needed.
+// It overflows if both high halves are non-zero, if either cross product does not fit in 64 bits,
+// or if adding the cross products into the high half of the low product carries out.
+BOOST_INT128_FORCE_INLINE constexpr bool umul_overflow(const uint128_t x, const uint128_t y, uint128_t& result) noexcept
+{
+    std::uint64_t p00_high {};
+    const auto p00_low {umul64(x.low, y.low, p00_high)};
+    std::uint64_t p01_high {};
+    const auto p01_low {umul64(x.low, y.high, p01_high)};
+    std::uint64_t p10_high {};
+    const auto p10_low {umul64(x.high, y.low, p10_high)};
+
+    const auto cross {p01_low + p10_low};
+    const auto high {cross + p00_high};
+
+    result = uint128_t{high, p00_low};
+
+    return static_cast<bool>(static_cast<unsigned>(x.high != 0U) & static_cast<unsigned>(y.high != 0U)) |
+           static_cast<bool>(static_cast<unsigned>(p01_high != 0U) | static_cast<unsigned>(p10_high != 0U)) |
+           static_cast<bool>(static_cast<unsigned>(cross < p01_low) | static_cast<unsigned>(high < cross));
+}
+
+} // namespace detail
+
+BOOST_INT128_EXPORT constexpr bool ckd_mul(uint128_t* result, const uint128_t x, const uint128_t y) noexcept
+{
+    return detail::umul_overflow(x, y, *result);
+}
+
+BOOST_INT128_EXPORT constexpr bool ckd_mul(int128_t* result, const int128_t x, const int128_t y) noexcept
+{
+    // Multiply the magnitudes, then the result fits if it is no larger than
+    // 2^127 - 1 for a positive product or 2^127 for a negative one
+    const auto x_mask {static_cast<uint128_t>(x >> 127)};
+    const auto y_mask {static_cast<uint128_t>(y >> 127)};
+    const auto abs_x {(static_cast<uint128_t>(x) ^ x_mask) - x_mask};
+    const auto abs_y {(static_cast<uint128_t>(y) ^ y_mask) - y_mask};
+
+    uint128_t magnitude {};
+    const auto overflow {detail::umul_overflow(abs_x, abs_y, magnitude)};
+
+    const auto sign_mask {x_mask ^ y_mask};
+    const auto limit {static_cast<uint128_t>((std::numeric_limits<int128_t>::max)()) - sign_mask};
+
+    *result = static_cast<int128_t>((magnitude ^ sign_mask) - sign_mask);
+
+    return static_cast<bool>(static_cast<unsigned>(overflow) | static_cast<unsigned>(magnitude > limit));
+}
+
+namespace detail {
+
+// All bits are set when the condition is true, so that the saturated value can be selected without a branch
+BOOST_INT128_FORCE_INLINE constexpr uint128_t select_mask(const bool condition) noexcept
+{
+    const auto mask {UINT64_C(0) - static_cast<std::uint64_t>(condition)};
+    return uint128_t{mask, mask};
+}
+
+BOOST_INT128_FORCE_INLINE constexpr int128_t select(const bool condition, const int128_t if_true, const int128_t if_false) noexcept
+{
+    const auto mask {select_mask(condition)};
+    return static_cast<int128_t>((static_cast<uint128_t>(if_true) & mask) | (static_cast<uint128_t>(if_false) & ~mask));
+}
+
+// max() when the sign bit of the value is clear and min() when it is set
+BOOST_INT128_FORCE_INLINE constexpr int128_t saturate_to_sign(const int128_t value) noexcept
+{
+    return (std::numeric_limits<int128_t>::max)() ^ (value >> 127);
+}
+
+} // namespace detail
+
+BOOST_INT128_EXPORT constexpr uint128_t add_sat(const uint128_t x, const uint128_t y) noexcept
+{
+    uint128_t res {};
+    const auto overflow {ckd_add(&res, x, y)};
+
+    return res | detail::select_mask(overflow);
+}
+
+BOOST_INT128_EXPORT constexpr uint128_t sub_sat(const uint128_t x, const uint128_t y) noexcept
+{
+    uint128_t res {};
+    const auto overflow {ckd_sub(&res, x, y)};
+
+    return res & ~detail::select_mask(overflow);
+}
+
+// Signed addition can only overflow in the direction of the sign of x,
+// and the same holds for subtraction since it only overflows when the signs differ
 
 BOOST_INT128_EXPORT constexpr int128_t add_sat(const int128_t x, const int128_t y) noexcept
 {
-    if (x >= 0 && y >= 0)
-    {
-        constexpr auto max_value {static_cast<uint128_t>((std::numeric_limits<int128_t>::max)())};
-        const auto big_x {static_cast<uint128_t>(x)};
-        const auto big_y {static_cast<uint128_t>(y)};
-        const auto big_res {big_x + big_y};
+    int128_t res {};
+    const auto overflow {ckd_add(&res, x, y)};
 
-        return big_res > max_value ? (std::numeric_limits<int128_t>::max)() : static_cast<int128_t>(big_res);
-    }
-    else if ((x < 0 && y > 0) || (x > 0 && y < 0))
+    return detail::select(overflow, detail::saturate_to_sign(x), res);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t sub_sat(const int128_t x, const int128_t y) noexcept
+{
+    int128_t res {};
+    const auto overflow {ckd_sub(&res, x, y)};
+
+    return detail::select(overflow, detail::saturate_to_sign(x), res);
+}
+
+BOOST_INT128_EXPORT constexpr uint128_t mul_sat(const uint128_t x, const uint128_t y) noexcept
+{
+    uint128_t res {};
+    const auto overflow {ckd_mul(&res, x, y)};
+
+    return res | detail::select_mask(overflow);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t mul_sat(const int128_t& x, const int128_t& y) noexcept
+{
+    int128_t res {};
+    const auto overflow {ckd_mul(&res, x, y)};
+
+    return detail::select(overflow, detail::saturate_to_sign(x ^ y), res);
+}
+
+BOOST_INT128_EXPORT constexpr uint128_t div_sat(const uint128_t x, const uint128_t y) noexcept
+{
+    return x / y;
+}
+
+BOOST_INT128_EXPORT constexpr int128_t div_sat(const int128_t x, const int128_t y) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(x == (std::numeric_limits<int128_t>::min)() && y == -1))
     {
-        return x + y;
+        // This is the only possible case of overflow
+        return (std::numeric_limits<int128_t>::max)();
     }
-    else
+
+    return x / y;
+}
+
+// Integer exponentiation by squaring. ipow wraps like the multiplication operators,
+// ckd_pow stores the wrapped result and reports whether the true power does not fit,
+// and pow_sat clamps to the limits of the type.
+
+BOOST_INT128_EXPORT constexpr uint128_t ipow(uint128_t base, unsigned exp) noexcept
+{
+    uint128_t result {1};
+    while (exp != 0U)
     {
-        // x < 0 and y < 0
-        // Nearly the same technique as the positive values case
-        constexpr auto max_value {-static_cast<uint128_t>((std::numeric_limits<int128_t>::min)())};
-        const auto big_x {static_cast<uint128_t>(abs(x))};
-        const auto big_y {static_cast<uint128_t>(abs(y))};
-        const auto big_res {big_x + big_y};
+        if ((exp & 1U) != 0U)
+        {
+            result *= base;
+        }
 
-        return big_res > max_value ? (std::numeric_limits<int128_t>::min)() : -static_cast<int128_t>(big_res);
+        exp >>= 1U;
+        base *= base;
     }
+
+    return result;
 }
 
-BOOST_INT128_EXPORT constexpr int128_t sub_sat(const int128_t x, const int128_t y) noexcept
+BOOST_INT128_EXPORT constexpr int128_t ipow(const int128_t base, const unsigned exp) noexcept
+{
+    return static_cast<int128_t>(ipow(static_cast<uint128_t>(base), exp));
+}
+
+namespace detail {
+
+// Stops as soon as a product overflows, in which case the result is unspecified
+constexpr bool upow_overflow(uint128_t base, unsigned exp, uint128_t& result) noexcept
 {
-    if (x <= 0 && y >= 0)
+    result = uint128_t{1};
+
+    if (base <= 1U)
     {
-        // Underflow case
-        const auto res {x - y};
-        return res > x ? (std::numeric_limits<int128_t>::min)() : res;
+        result = exp == 0U ? uint128_t{1} : base;
+        return false;
     }
-    else if (x > 0 && y < 0)
-    {
-        // Overflow Case
-        constexpr auto max_val {static_cast<uint128_t>((std::numeric_limits<int128_t>::max)())};
-        const auto big_x {static_cast<uint128_t>(x)};
-        const auto big_y {-static_cast<uint128_t>(y)};
-        const auto res {big_x + big_y};
 
-        return (res > max_val || res < big_x) ? (std::numeric_limits<int128_t>::max)() : static_cast<int128_t>(res);
+    // base^exp >= 2^((bit_width(base) - 1) * exp)
+    if (static_cast<unsigned long long>(bit_width(base) - 1) * exp >= 128U)
+    {
+        return true;
     }
-    else
+
+    while (true)
     {
-        return x - y;
+        if ((exp & 1U) != 0U && umul_overflow(result, base, result))
+        {
+            return true;
+        }
+
+        exp >>= 1U;
+        if (exp == 0U)
+        {
+            return false;
+        }
+
+        if (umul_overflow(base, base, base))
+        {
+            return true;
+        }
     }
 }
 
-#ifdef _MSC_VER
-#  pragma warning(pop)
-#endif
-
-BOOST_INT128_EXPORT constexpr uint128_t mul_sat(const uint128_t x, const uint128_t y) noexcept
+// The magnitude of base^exp fits when it is at most 2^127 - 1, or 2^127 for a negative result
+constexpr bool ipow_overflow(const int128_t base, const unsigned exp, bool& negative) noexcept
 {
-    const auto x_bits {bit_width(x)};
-    const auto y_bits {bit_width(y)};
+    const auto mask {static_cast<uint128_t>(base >> 127)};
+    const auto magnitude_base {(static_cast<uint128_t>(base) ^ mask) - mask};
+
+    negative = base < 0 && (exp & 1U) != 0U;
+
+    uint128_t magnitude {};
+    const auto overflow {upow_overflow(magnitude_base, exp, magnitude)};
+    const auto limit {static_cast<uint128_t>((std::numeric_limits<int128_t>::max)()) + static_cast<unsigned>(negative)};
 
-    if ((x_bits + y_bits) > std::numeric_limits<uint128_t>::digits)
+    return overflow || magnitude > limit;
+}
+
+} // namespace detail
+
+BOOST_INT128_EXPORT constexpr bool ckd_pow(uint128_t* result, const uint128_t base, const unsigned exp) noexcept
+{
+    if (detail::upow_overflow(base, exp, *result))
     {
-        return (std::numeric_limits<uint128_t>::max)();
+        *result = ipow(base, exp);
+        return true;
     }
 
-    return x * y;
+    return false;
 }
 
-BOOST_INT128_EXPORT constexpr int128_t mul_sat(const int128_t& x, const int128_t& y) noexcept
+BOOST_INT128_EXPORT constexpr bool ckd_pow(int128_t* result, const int128_t base, const unsigned exp) noexcept
 {
-    const auto x_bits {bit_width(static_cast<uint128_t>(abs(x)))};
-    const auto y_bits {bit_width(static_cast<uint128_t>(abs(y)))};
+    bool negative {};
+    const auto overflow {detail::ipow_overflow(base, exp, negative)};
+    *result = ipow(base, exp);
+
+    return overflow;
+}
 
-    if ((x_bits + y_bits) > std::numeric_limits<int128_t>::digits)
+BOOST_INT128_EXPORT constexpr uint128_t pow_sat(const uint128_t base, const unsigned exp) noexcept
+{
+    uint128_t result {};
+    if (detail::upow_overflow(base, exp, result))
     {
-        if ((x < 0) != (y < 0))
-        {
-            return (std::numeric_limits<int128_t>::min)();
-        }
-        else
-        {
-            return (std::numeric_limits<int128_t>::max)();
-        }
+        return (std::numeric_limits<uint128_t>::max)();
     }
 
-    const int128_t res {x * y};
-    return res;
+    return result;
 }
 
-BOOST_INT128_EXPORT constexpr uint128_t div_sat(const uint128_t x, const uint128_t y) noexcept
+BOOST_INT128_EXPORT constexpr int128_t pow_sat(const int128_t base, const unsigned exp) noexcept
 {
-    return x / y;
+    bool negative {};
+    if (detail::ipow_overflow(base, exp, negative))
+    {
+        return negative ? (std::numeric_limits<int128_t>::min)() : (std::numeric_limits<int128_t>::max)();
+    }
+
+    return ipow(base, exp);
 }
 
-BOOST_INT128_EXPORT constexpr int128_t div_sat(const int128_t x, const int128_t y) noexcept
+namespace detail {
+
+template <typename T>
+struct pow10_array
 {
-    if (BOOST_INT128_UNLIKELY(x == (std::numeric_limits<int128_t>::min)() && y == -1))
+    static_assert(std::is_same<T, uint128_t>::value || std::is_same<T, int128_t>::value,
+                  "Powers of ten are only tabulated for uint128_t and int128_t");
+
+    constexpr T operator[](const std::size_t i) const noexcept
     {
-        // This is the only possible case of overflow
-        return (std::numeric_limits<int128_t>::max)();
+        BOOST_INT128_ASSERT_MSG(i < size(), "Only 10^0 through 10^38 fit in 128 bits");
+        return static_cast<T>(pow10_u128[i]);
     }
 
-    return x / y;
-}
+    static constexpr std::size_t size() noexcept
+    {
+        return sizeof(pow10_u128) / sizeof(pow10_u128[0]);
+    }
+};
+
+} // namespace detail
+
+// pow10_table<T>[k] is 10^k for k in [0, 38], the powers of ten representable in both types
+
+BOOST_INT128_EXPORT template <typename T>
+BOOST_INT128_INLINE_CONSTEXPR detail::pow10_array<T> pow10_table {};
 
 #ifdef _MSC_VER
 #  pragma warning(push)
@@ -266,124 +512,452 @@ constexpr std::uint64_t gcd64(std::uint64_t x, std::uint64_t y) noexcept
 
     const auto s {impl::countr_impl(x | y)};
     x >>= impl::countr_impl(x);
+    y >>= impl::countr_impl(y);
 
-    do
+    // Both values stay odd, so the difference is even and non-zero until they meet.
+    // Taking the min and the difference from one comparison lets the compiler use conditional moves.
+    while (x != y)
     {
-        y >>= impl::countr_impl(y);
-        if (x > y)
-        {
-            const auto temp {x};
-            x = y;
-            y = temp;
-        }
+        const auto larger {x > y ? x : y};
+        const auto smaller {x > y ? y : x};
+        const auto difference {larger - smaller};
 
-        y -= x;
-    } while (y);
+        x = smaller;
+        y = difference >> impl::countr_impl(difference);
+    }
 
     return x << s;
 }
 
-} // namespace detail
+// Cofactors of a Lehmer step. The leading digits are kept to 62 bits so that u_hat + a and v_hat + c never overflow
+struct lehmer_matrix
+{
+    std::int64_t a {1};
+    std::int64_t b {0};
+    std::int64_t c {0};
+    std::int64_t d {1};
+};
 
-constexpr uint128_t gcd(uint128_t a, uint128_t b) noexcept
+// See: The Art of Computer Programming Volume 2 (Semi-numerical algorithms) section 4.5.2
+// Algorithm L: runs the Euclidean algorithm on the leading 62 bits of u >= v for as long as the quotients
+// are guaranteed to match those of the full values. The matrix is trivial (b == 0) if no step was taken.
+BOOST_INT128_FORCE_INLINE constexpr lehmer_matrix lehmer_step(const uint128_t u, const uint128_t v) noexcept
 {
-    // Base case
-    if (a == 0U)
-    {
-        return b;
-    }
-    if (b == 0U)
-    {
-        return a;
-    }
+    const auto shift {countl_zero(u)};
+    auto u_hat {static_cast<std::int64_t>((u << shift).high >> 2U)};
+    auto v_hat {static_cast<std::int64_t>((v << shift).high >> 2U)};
 
-    const auto a_zero {countr_zero(a)};
-    const auto b_zero {countr_zero(b)};
-    const auto shift {b_zero < a_zero ? b_zero : a_zero};
-    a >>= shift;
-    b >>= shift;
+    lehmer_matrix m {};
 
-    do
+    while (v_hat + m.c > 0 && v_hat + m.d > 0)
     {
-        b >>= countr_zero(b);
-
-        if (a > b)
+        const auto q {(u_hat + m.a) / (v_hat + m.c)};
+        if (q != (u_hat + m.b) / (v_hat + m.d))
         {
-            const uint128_t temp {a};
-            a = b;
-            b = temp;
+            break;
         }
 
-        b -= a;
+        auto t {m.a - q * m.c};
+        m.a = m.c;
+        m.c = t;
 
-        // Stop doing 128-bit math as soon as we can
-        if (a.high == 0U && b.high == 0U)
-        {
-            const auto g {detail::gcd64(a.low, b.low)};
-            return uint128_t{0, g} << shift;
-        }
+        t = m.b - q * m.d;
+        m.b = m.d;
+        m.d = t;
 
-    } while (b != 0U);
+        t = u_hat - q * v_hat;
+        u_hat = v_hat;
+        v_hat = t;
+    }
 
-    return a << shift;
+    return m;
 }
 
-constexpr int128_t gcd(const int128_t a, const int128_t b) noexcept
+// Exact linear combinations are evaluated modulo 2^128 since the results are known to be in range
+BOOST_INT128_FORCE_INLINE constexpr uint128_t lehmer_combine(const std::int64_t a, const uint128_t x, const std::int64_t b, const uint128_t y) noexcept
 {
-    return static_cast<int128_t>(gcd(static_cast<uint128_t>(abs(a)), static_cast<uint128_t>(abs(b))));
+    return x * static_cast<uint128_t>(static_cast<int128_t>(a)) + y * static_cast<uint128_t>(static_cast<int128_t>(b));
 }
 
-// For unknown reasons this implementation fails for MSVC x86 only in release mode
-// Directly calculating leads to the same failures, so unfortunately we have a viable,
-// but very slow impl that we know works.
-#if !(defined(_M_IX86) && !defined(_NDEBUG))
+} // namespace detail
 
-constexpr uint128_t lcm(const uint128_t a, const uint128_t b) noexcept
+// The full 256-bit product split into its high and low halves.
+// The low half is always unsigned since it has no sign of its own.
+BOOST_INT128_EXPORT template <typename T>
+struct mul_wide_result
 {
-    if (a == 0U || b == 0U)
-    {
-        return static_cast<uint128_t>(0);
-    }
+    T hi;
+    uint128_t lo;
+};
 
-    // Calculate GCD first
-    const auto g {gcd(a, b)};
+namespace detail {
 
-    // Compute LCM avoiding overflow: (a/gcd) * b
-    return (a / g) * b;
+// High 128 bits of the 256-bit product
+BOOST_INT128_FORCE_INLINE constexpr uint128_t umulhi(const uint128_t lhs, const uint128_t rhs) noexcept
+{
+    uint128_t high {};
+    static_cast<void>(umul_wide(lhs, rhs, high));
+    return high;
 }
 
-#else
-
-constexpr uint128_t lcm(uint128_t a, uint128_t b) noexcept
+// Convert the unsigned product into the signed one by removing
+// the contribution of the sign bits without branching
+BOOST_INT128_FORCE_INLINE constexpr int128_t signed_high(const int128_t lhs, const int128_t rhs, uint128_t high) noexcept
 {
-    if (a == 0U || b == 0U)
-    {
-        return 0;
-    }
+    high -= static_cast<uint128_t>(lhs >> 127) & static_cast<uint128_t>(rhs);
+    high -= static_cast<uint128_t>(rhs >> 127) & static_cast<uint128_t>(lhs);
 
+    return static_cast<int128_t>(high);
+}
 
-    unsigned shift{};
-    while ((a & 1U) == 0U && (b & 1U) == 0U) 
-    {
-        a >>= 1U;
-        b >>= 1U;
-        shift++;
-    }
-
-    // Ensure a >= b
-    if (a < b)
-    {
-        std::swap(a, b);
-    }
+BOOST_INT128_FORCE_INLINE constexpr int128_t smulhi(const int128_t lhs, const int128_t rhs) noexcept
+{
+    return signed_high(lhs, rhs, umulhi(static_cast<uint128_t>(lhs), static_cast<uint128_t>(rhs)));
+}
 
-    uint128_t lcm{a};
+} // namespace detail
 
-    while (lcm % b != 0U) 
-    {
-        lcm += a;
-    }
+BOOST_INT128_EXPORT constexpr mul_wide_result<uint128_t> mul_wide(const uint128_t x, const uint128_t y) noexcept
+{
+    uint128_t high {};
+    const auto low {detail::umul_wide(x, y, high)};
 
-    return lcm << shift;
+    return {high, low};
+}
+
+BOOST_INT128_EXPORT constexpr mul_wide_result<int128_t> mul_wide(const int128_t x, const int128_t y) noexcept
+{
+    uint128_t high {};
+    const auto low {detail::umul_wide(static_cast<uint128_t>(x), static_cast<uint128_t>(y), high)};
+
+    return {detail::signed_high(x, y, high), low};
+}
+
+BOOST_INT128_EXPORT constexpr uint128_t mulhi(const uint128_t x, const uint128_t y) noexcept
+{
+    return detail::umulhi(x, y);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t mulhi(const int128_t x, const int128_t y) noexcept
+{
+    return detail::smulhi(x, y);
+}
+
+namespace detail {
+
+// Signed 64 x 64 -> 128 product, portably computed from the unsigned one by removing the contribution of the sign bits
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t smul64(const std::int64_t lhs, const std::int64_t rhs, std::uint64_t& high) noexcept
+{
+    #if defined(BOOST_INT128_HAS_INT128)
+
+    const auto product {static_cast<builtin_i128>(lhs) * rhs};
+    high = static_cast<std::uint64_t>(static_cast<builtin_u128>(product) >> 64U);
+    return static_cast<std::uint64_t>(product);
+
+    #else
+
+    const auto unsigned_lhs {static_cast<std::uint64_t>(lhs)};
+    const auto unsigned_rhs {static_cast<std::uint64_t>(rhs)};
+
+    const auto low {umul64(unsigned_lhs, unsigned_rhs, high)};
+    high -= static_cast<std::uint64_t>(lhs >> 63) & unsigned_rhs;
+    high -= static_cast<std::uint64_t>(rhs >> 63) & unsigned_lhs;
+
+    return low;
+
+    #endif
+}
+
+// Carry-save accumulator for sums of 128-bit products.
+// The carries out of the low word are counted separately instead of being propagated into the high word,
+// so consecutive additions do not form a single dependency chain through the carry flag.
+struct carry_save_accumulator
+{
+    std::uint64_t low {};
+    std::uint64_t carries {};
+    std::uint64_t high {};
+
+    BOOST_INT128_FORCE_INLINE constexpr void add(const std::uint64_t product_high, const std::uint64_t product_low) noexcept
+    {
+        low += product_low;
+        carries += static_cast<std::uint64_t>(low < product_low);
+        high += product_high;
+    }
+
+    constexpr uint128_t value() const noexcept
+    {
+        return uint128_t{high + carries, low};
+    }
+};
+
+// Function objects instead of lambdas since lambdas are not constexpr before C++17
+struct umul64_op
+{
+    BOOST_INT128_FORCE_INLINE constexpr std::uint64_t operator()(const std::uint64_t lhs, const std::uint64_t rhs, std::uint64_t& high) const noexcept
+    {
+        return umul64(lhs, rhs, high);
+    }
+};
+
+struct smul64_op
+{
+    BOOST_INT128_FORCE_INLINE constexpr std::uint64_t operator()(const std::int64_t lhs, const std::int64_t rhs, std::uint64_t& high) const noexcept
+    {
+        return smul64(lhs, rhs, high);
+    }
+};
+
+template <typename T, typename Mul>
+constexpr uint128_t dot_product_impl(const T* lhs, const T* rhs, const std::size_t n, Mul mul) noexcept
+{
+    // Four independent accumulators keep several multiplications in flight
+    carry_save_accumulator acc[4] {};
+
+    std::size_t i {};
+    for (; i + 4U <= n; i += 4U)
+    {
+        for (std::size_t j {}; j < 4U; ++j)
+        {
+            std::uint64_t high {};
+            const auto low {mul(lhs[i + j], rhs[i + j], high)};
+            acc[j].add(high, low);
+        }
+    }
+    for (; i < n; ++i)
+    {
+        std::uint64_t high {};
+        const auto low {mul(lhs[i], rhs[i], high)};
+        acc[0].add(high, low);
+    }
+
+    return acc[0].value() + acc[1].value() + acc[2].value() + acc[3].value();
+}
+
+} // namespace detail
+
+// Widening multiply-add: a * b + c where the product is computed in 128 bits.
+// The sum wraps modulo 2^128 like the other arithmetic operators.
+
+BOOST_INT128_EXPORT constexpr uint128_t muladd(const std::uint64_t a, const std::uint64_t b, const uint128_t c) noexcept
+{
+    std::uint64_t high {};
+    const auto low {detail::umul64(a, b, high)};
+
+    return uint128_t{high, low} + c;
+}
+
+BOOST_INT128_EXPORT constexpr int128_t muladd(const std::int64_t a, const std::int64_t b, const int128_t c) noexcept
+{
+    std::uint64_t high {};
+    const auto low {detail::smul64(a, b, high)};
+
+    return static_cast<int128_t>(uint128_t{high, low} + static_cast<uint128_t>(c));
+}
+
+// Sum of lhs[i] * rhs[i] for i in [0, n) with every product computed exactly in 128 bits.
+// The sum wraps modulo 2^128 like muladd.
+
+BOOST_INT128_EXPORT constexpr uint128_t dot_product(const std::uint64_t* lhs, const std::uint64_t* rhs, const std::size_t n) noexcept
+{
+    return detail::dot_product_impl(lhs, rhs, n, detail::umul64_op {});
+}
+
+BOOST_INT128_EXPORT constexpr int128_t dot_product(const std::int64_t* lhs, const std::int64_t* rhs, const std::size_t n) noexcept
+{
+    // Two's complement addition is the same for signed values, so the signed
+    // products can share the unsigned accumulators
+    return static_cast<int128_t>(detail::dot_product_impl(lhs, rhs, n, detail::smul64_op {}));
+}
+
+namespace detail {
+
+// Inverse of an odd value modulo 2^64 using Newton's iteration x = x * (2 - d * x),
+// which doubles the number of correct low bits at each step.
+// (3 * d) ^ 2 is correct to 5 bits, so four steps are needed.
+constexpr std::uint64_t inverse_mod_2_64(const std::uint64_t d) noexcept
+{
+    BOOST_INT128_ASSUME((d & 1U) == 1U); // LCOV_EXCL_LINE
+
+    auto x {(d * 3U) ^ 2U};
+    x *= 2U - d * x;
+    x *= 2U - d * x;
+    x *= 2U - d * x;
+    x *= 2U - d * x;
+
+    return x;
+}
+
+// The same iteration extended by one 128-bit step
+constexpr uint128_t inverse_mod_2_128(const uint128_t d) noexcept
+{
+    const uint128_t wide_x {0, inverse_mod_2_64(d.low)};
+    return wide_x * (uint128_t{0, 2} - d * wide_x);
+}
+
+} // namespace detail
+
+// Divides x by d when d is known to divide x exactly.
+// The division is replaced by a multiplication with the inverse of the odd part of d mod 2^128,
+// so the result is meaningless if the remainder is not zero.
+BOOST_INT128_EXPORT constexpr uint128_t divexact(const uint128_t x, const uint128_t d) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(d == 0U))
+    {
+        return uint128_t{0};
+    }
+
+    const auto s {countr_zero(d)};
+
+    return (x >> s) * detail::inverse_mod_2_128(d >> s);
+}
+
+BOOST_INT128_EXPORT constexpr int128_t divexact(const int128_t x, const int128_t d) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(d == 0))
+    {
+        return int128_t{0};
+    }
+
+    // The exact quotient is the same modulo 2^128 whatever the signs,
+    // and the arithmetic shifts keep the signs of the operands
+    const auto s {countr_zero(static_cast<uint128_t>(d))};
+    const auto odd_d {static_cast<uint128_t>(d >> s)};
+
+    return static_cast<int128_t>(static_cast<uint128_t>(x >> s) * detail::inverse_mod_2_128(odd_d));
+}
+
+// Returns whether x % d == 0 without dividing.
+// With d = 2^s * m where m is odd, multiplying x by the inverse of m gives x / m
+// if and only if m divides x, in which case the product with m does not overflow.
+// Zero is only divisible by zero.
+BOOST_INT128_EXPORT constexpr bool is_divisible(const uint128_t x, const uint128_t d) noexcept
+{
+    if (BOOST_INT128_UNLIKELY(d == 0U))
+    {
+        return x == 0U;
+    }
+
+    const auto s {countr_zero(d)};
+    if (countr_zero(x) < s)
+    {
+        return false;
+    }
+
+    const auto odd_d {d >> s};
+    const auto candidate {(x >> s) * detail::inverse_mod_2_128(odd_d)};
+
+    uint128_t high {};
+    static_cast<void>(detail::umul_wide(candidate, odd_d, high));
+
+    return high == 0U;
+}
+
+BOOST_INT128_EXPORT constexpr bool is_divisible(const int128_t x, const int128_t d) noexcept
+{
+    return is_divisible(static_cast<uint128_t>(abs(x)), static_cast<uint128_t>(abs(d)));
+}
+
+constexpr uint128_t gcd(uint128_t a, uint128_t b) noexcept
+{
+    if (a < b)
+    {
+        const uint128_t temp {a};
+        a = b;
+        b = temp;
+    }
+
+    // Lehmer steps take the quotients from the leading words, so dissimilar magnitudes
+    // cost a single division instead of a long run of subtractions
+    while (b.high != 0U)
+    {
+        const auto m {detail::lehmer_step(a, b)};
+
+        if (m.b == 0)
+        {
+            const auto r {a % b};
+            a = b;
+            b = r;
+            continue;
+        }
+
+        const auto new_a {detail::lehmer_combine(m.a, a, m.b, b)};
+        b = detail::lehmer_combine(m.c, a, m.d, b);
+        a = new_a;
+    }
+
+    if (b == 0U)
+    {
+        return a;
+    }
+
+    if (a.high != 0U)
+    {
+        const auto r {a % b};
+        a = b;
+        b = r;
+    }
+
+    // Stop doing 128-bit math as soon as we can
+    return uint128_t{detail::gcd64(a.low, b.low)};
+}
+
+constexpr int128_t gcd(const int128_t a, const int128_t b) noexcept
+{
+    return static_cast<int128_t>(gcd(static_cast<uint128_t>(abs(a)), static_cast<uint128_t>(abs(b))));
+}
+
+// For unknown reasons this implementation fails for MSVC x86 only in release mode
+// Directly calculating leads to the same failures, so unfortunately we have a viable,
+// but very slow impl that we know works.
+#if !(defined(_M_IX86) && !defined(_NDEBUG))
+
+constexpr uint128_t lcm(const uint128_t a, const uint128_t b) noexcept
+{
+    if (a == 0U || b == 0U)
+    {
+        return static_cast<uint128_t>(0);
+    }
+
+    // Calculate GCD first
+    const auto g {gcd(a, b)};
+
+    // Compute LCM avoiding overflow: (a/gcd) * b
+    // gcd divides a, so the division is exact
+    return divexact(a, g) * b;
+}
+
+#else
+
+constexpr uint128_t lcm(uint128_t a, uint128_t b) noexcept
+{
+    if (a == 0U || b == 0U)
+    {
+        return 0;
+    }
+
+
+    unsigned shift{};
+    while ((a & 1U) == 0U && (b & 1U) == 0U) 
+    {
+        a >>= 1U;
+        b >>= 1U;
+        shift++;
+    }
+
+    // Ensure a >= b
+    if (a < b)
+    {
+        std::swap(a, b);
+    }
+
+    uint128_t lcm{a};
+
+    while (lcm % b != 0U) 
+    {
+        lcm += a;
+    }
+
+    return lcm << shift;
 }
 
 #endif
@@ -393,6 +967,1278 @@ constexpr int128_t lcm(const int128_t a, const int128_t b) noexcept
     return static_cast<int128_t>(lcm(static_cast<uint128_t>(abs(a)), static_cast<uint128_t>(abs(b))));
 }
 
+namespace detail {
+
+template <typename T>
+BOOST_INT128_INLINE_CONSTEXPR bool is_int128_v {std::is_same<T, uint128_t>::value || std::is_same<T, int128_t>::value};
+
+constexpr uint128_t gcd_magnitude(const uint128_t x) noexcept
+{
+    return x;
+}
+
+constexpr uint128_t gcd_magnitude(const int128_t x) noexcept
+{
+    return static_cast<uint128_t>(abs(x));
+}
+
+// Two binary gcds of non-zero values run in lockstep so that their dependency chains overlap.
+// A lane that has finished has a zero difference and keeps y == x until the other one catches up.
+BOOST_INT128_FORCE_INLINE constexpr void gcd64_x2(std::uint64_t& x0, std::uint64_t y0, std::uint64_t& x1, std::uint64_t y1) noexcept
+{
+    constexpr std::uint64_t guard {UINT64_C(1) << 63U};
+
+    const auto s0 {impl::countr_impl(x0 | y0)};
+    const auto s1 {impl::countr_impl(x1 | y1)};
+    x0 >>= impl::countr_impl(x0);
+    y0 >>= impl::countr_impl(y0);
+    x1 >>= impl::countr_impl(x1);
+    y1 >>= impl::countr_impl(y1);
+
+    while (x0 != y0 || x1 != y1)
+    {
+        const auto smaller0 {x0 > y0 ? y0 : x0};
+        const auto difference0 {(x0 > y0 ? x0 : y0) - smaller0};
+        const auto smaller1 {x1 > y1 ? y1 : x1};
+        const auto difference1 {(x1 > y1 ? x1 : y1) - smaller1};
+
+        x0 = smaller0;
+        x1 = smaller1;
+        y0 = difference0 == 0U ? smaller0 : difference0 >> impl::countr_impl(difference0 | guard);
+        y1 = difference1 == 0U ? smaller1 : difference1 >> impl::countr_impl(difference1 | guard);
+    }
+
+    x0 <<= s0;
+    x1 <<= s1;
+}
+
+// Folds x0 into g0 and x1 into g1. Once both running values fit into a word, every new element
+// only costs one narrow remainder before the two word sized gcds are interleaved.
+constexpr void gcd_lanes(uint128_t& g0, const uint128_t x0, uint128_t& g1, const uint128_t x1) noexcept
+{
+    if (g0.high == 0U && g1.high == 0U && g0 != 0U && g1 != 0U)
+    {
+        const auto r0 {x0 % g0.low};
+        const auto r1 {x1 % g1.low};
+
+        // A zero remainder leaves the lane unchanged, which is expressed as gcd(g, g)
+        auto a0 {g0.low};
+        auto a1 {g1.low};
+        gcd64_x2(a0, r0 == 0U ? a0 : r0.low, a1, r1 == 0U ? a1 : r1.low);
+
+        g0 = uint128_t{a0};
+        g1 = uint128_t{a1};
+    }
+    else
+    {
+        g0 = gcd(g0, x0);
+        g1 = gcd(g1, x1);
+    }
+}
+
+} // namespace detail
+
+// gcd of every element in [first, last), which is zero for an empty range.
+// Alternate elements are folded into two independent running values that are
+// combined at the end, returning early as soon as either of them reaches one.
+
+BOOST_INT128_EXPORT template <typename InputIt, std::enable_if_t<detail::is_int128_v<typename std::iterator_traits<InputIt>::value_type>, bool> = true>
+constexpr typename std::iterator_traits<InputIt>::value_type gcd_reduce(InputIt first, const InputIt last) noexcept
+{
+    using value_type = typename std::iterator_traits<InputIt>::value_type;
+
+    uint128_t lane0 {0};
+    uint128_t lane1 {0};
+
+    while (first != last)
+    {
+        const auto x0 {detail::gcd_magnitude(*first)};
+        ++first;
+
+        if (first == last)
+        {
+            lane0 = gcd(lane0, x0);
+            break;
+        }
+
+        const auto x1 {detail::gcd_magnitude(*first)};
+        ++first;
+
+        detail::gcd_lanes(lane0, x0, lane1, x1);
+
+        if (lane0 == 1U || lane1 == 1U)
+        {
+            return value_type{1};
+        }
+    }
+
+    return static_cast<value_type>(gcd(lane0, lane1));
+}
+
+// lcm of every element in [first, last), which is one for an empty range.
+// Returns early with zero once a zero element is seen.
+// If the result does not fit into the value type it is unspecified.
+
+BOOST_INT128_EXPORT template <typename InputIt, std::enable_if_t<detail::is_int128_v<typename std::iterator_traits<InputIt>::value_type>, bool> = true>
+constexpr typename std::iterator_traits<InputIt>::value_type lcm_reduce(InputIt first, const InputIt last) noexcept
+{
+    using value_type = typename std::iterator_traits<InputIt>::value_type;
+
+    value_type lane0 {1};
+    value_type lane1 {1};
+
+    while (first != last)
+    {
+        const value_type x0 {*first};
+        ++first;
+
+        if (first == last)
+        {
+            lane0 = lcm(lane0, x0);
+            break;
+        }
+
+        const value_type x1 {*first};
+        ++first;
+
+        lane0 = lcm(lane0, x0);
+        lane1 = lcm(lane1, x1);
+
+        if (lane0 == value_type{0} || lane1 == value_type{0})
+        {
+            return value_type{0};
+        }
+    }
+
+    return lcm(lane0, lane1);
+}
+
+// Bezout coefficients with a * x + b * y == g
+BOOST_INT128_EXPORT template <typename T>
+struct extended_gcd_result
+{
+    T g;
+    int128_t x;
+    int128_t y;
+};
+
+// Optional-like result since std::optional is not available in C++14
+BOOST_INT128_EXPORT template <typename T>
+struct mod_inverse_result
+{
+    T value;
+    bool exists;
+
+    constexpr explicit operator bool() const noexcept { return exists; }
+};
+
+namespace detail {
+
+// One quotient step at full precision, which also orders u >= v when the quotient is zero
+template <bool need_y>
+BOOST_INT128_FORCE_INLINE constexpr void euclid_step(uint128_t& u, uint128_t& v, uint128_t& x0, uint128_t& x1,
+                                                     uint128_t& y0, uint128_t& y1, const uint128_t q) noexcept
+{
+    const auto r {u - q * v};
+    u = v;
+    v = r;
+
+    const auto x {x0 - q * x1};
+    x0 = x1;
+    x1 = x;
+
+    BOOST_INT128_IF_CONSTEXPR (need_y)
+    {
+        const auto y {y0 - q * y1};
+        y0 = y1;
+        y1 = y;
+    }
+}
+
+// Euclidean algorithm tracking the cofactors x and y of u_i == x_i * a + y_i * b.
+// The cofactors only need to be correct modulo 2^128, because the final ones fit in an int128_t
+// (|x| <= b / 2g and |y| <= a / 2g), so intermediate wrap-around is harmless.
+template <bool need_y>
+constexpr uint128_t extended_euclid(uint128_t u, uint128_t v, uint128_t& x, uint128_t& y) noexcept
+{
+    uint128_t x0 {1};
+    uint128_t x1 {0};
+    uint128_t y0 {0};
+    uint128_t y1 {1};
+
+    if (u < v)
+    {
+        euclid_step<need_y>(u, v, x0, x1, y0, y1, uint128_t{0});
+    }
+
+    // Lehmer steps replace most of the 128-bit divisions by single word arithmetic
+    while (v.high != 0U)
+    {
+        const auto m {lehmer_step(u, v)};
+
+        if (m.b == 0)
+        {
+            euclid_step<need_y>(u, v, x0, x1, y0, y1, u / v);
+            continue;
+        }
+
+        const auto new_u {lehmer_combine(m.a, u, m.b, v)};
+        v = lehmer_combine(m.c, u, m.d, v);
+        u = new_u;
+
+        const auto new_x0 {lehmer_combine(m.a, x0, m.b, x1)};
+        x1 = lehmer_combine(m.c, x0, m.d, x1);
+        x0 = new_x0;
+
+        BOOST_INT128_IF_CONSTEXPR (need_y)
+        {
+            const auto new_y0 {lehmer_combine(m.a, y0, m.b, y1)};
+            y1 = lehmer_combine(m.c, y0, m.d, y1);
+            y0 = new_y0;
+        }
+    }
+
+    if (v == 0U)
+    {
+        x = x0;
+        y = y0;
+        return u;
+    }
+
+    if (u.high != 0U)
+    {
+        euclid_step<need_y>(u, v, x0, x1, y0, y1, u / v);
+    }
+
+    // Stop doing 128-bit math on the remainders as soon as we can
+    auto u64 {u.low};
+    auto v64 {v.low};
+
+    while (v64 != 0U)
+    {
+        const auto q {u64 / v64};
+
+        const auto r {u64 - q * v64};
+        u64 = v64;
+        v64 = r;
+
+        const auto c {x0 - x1 * q};
+        x0 = x1;
+        x1 = c;
+
+        BOOST_INT128_IF_CONSTEXPR (need_y)
+        {
+            const auto d {y0 - y1 * q};
+            y0 = y1;
+            y1 = d;
+        }
+    }
+
+    x = x0;
+    y = y0;
+
+    return uint128_t{u64};
+}
+
+} // namespace detail
+
+// Computes g = gcd(a, b) along with x and y such that a * x + b * y == g.
+// The coefficients are the minimal ones produced by the Euclidean algorithm.
+
+BOOST_INT128_EXPORT constexpr extended_gcd_result<uint128_t> extended_gcd(const uint128_t a, const uint128_t b) noexcept
+{
+    uint128_t x {};
+    uint128_t y {};
+    const auto g {detail::extended_euclid<true>(a, b, x, y)};
+
+    return {g, static_cast<int128_t>(x), static_cast<int128_t>(y)};
+}
+
+BOOST_INT128_EXPORT constexpr extended_gcd_result<int128_t> extended_gcd(const int128_t a, const int128_t b) noexcept
+{
+    const auto abs_a {a < 0 ? -static_cast<uint128_t>(a) : static_cast<uint128_t>(a)};
+    const auto abs_b {b < 0 ? -static_cast<uint128_t>(b) : static_cast<uint128_t>(b)};
+
+    const auto result {extended_gcd(abs_a, abs_b)};
+
+    return {static_cast<int128_t>(result.g), a < 0 ? -result.x : result.x, b < 0 ? -result.y : result.y};
+}
+
+// Computes the x in [0, m) with a * x == 1 (mod m) if it exists, i.e. if gcd(a, m) == 1
+
+BOOST_INT128_EXPORT constexpr mod_inverse_result<uint128_t> mod_inverse(const uint128_t a, const uint128_t m) noexcept
+{
+    if (m == 0U)
+    {
+        return {uint128_t{0}, false};
+    }
+
+    uint128_t x {};
+    uint128_t y {};
+    const auto g {detail::extended_euclid<false>(a % m, m, x, y)};
+
+    if (g != 1U)
+    {
+        return {uint128_t{0}, false};
+    }
+
+    // The coefficient lies in (-m, m), so negative values need a single correction
+    const auto value {static_cast<int128_t>(x) < 0 ? x + m : x};
+
+    return {value, true};
+}
+
+// Arithmetic modulo an odd m in Montgomery form, where x is represented by x * R mod m with R = 2^128.
+// Products are reduced with multiplications and a conditional subtraction instead of a 256-bit division.
+// See: P. Montgomery, Modular Multiplication Without Trial Division, 1985
+BOOST_INT128_EXPORT template <typename T>
+class montgomery_context;
+
+BOOST_INT128_EXPORT template <>
+class montgomery_context<uint128_t>
+{
+private:
+
+    uint128_t modulus_ {};
+    uint128_t inverse_ {};    // m^-1 mod R
+    uint128_t r_mod_m_ {};    // R mod m, which is 1 in Montgomery form
+    uint128_t r2_mod_m_ {};   // R^2 mod m, used to convert into Montgomery form
+
+    // Computes t * R^-1 mod m for t = high * R + low < m * R.
+    // With u = low * m^-1 mod R, t - u * m is divisible by R and the low halves cancel exactly,
+    // so the result is high - mulhi(u, m) which lies in (-m, m). Unlike the t + u * (-m^-1) form
+    // this can not overflow, so every odd modulus up to 2^128 - 1 is supported.
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t redc(const uint128_t high, const uint128_t low) const noexcept
+    {
+        const auto u {low * inverse_};
+        const auto um_high {detail::umulhi(u, modulus_)};
+
+        const auto res {high - um_high};
+        return res + (modulus_ & detail::select_mask(high < um_high));
+    }
+
+public:
+
+    explicit constexpr montgomery_context(const uint128_t m) noexcept : modulus_ {m}
+    {
+        BOOST_INT128_ASSERT_MSG((m.low & 1U) == 1U, "The modulus must be odd");
+        BOOST_INT128_ASSERT_MSG(m != 1U, "The modulus must be greater than 1");
+
+        inverse_ = detail::inverse_mod_2_128(m);
+
+        // R mod m == (R - m) mod m, which is representable
+        r_mod_m_ = (uint128_t{0} - m) % m;
+
+        // R^2 mod m == (R mod m) * R mod m
+        static_cast<void>(detail::knuth_div_wide(r_mod_m_, uint128_t{0}, m, r2_mod_m_));
+    }
+
+    constexpr uint128_t modulus() const noexcept { return modulus_; }
+
+    // 1 in Montgomery form
+    constexpr uint128_t one() const noexcept { return r_mod_m_; }
+
+    // Any value is accepted, the result is reduced
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t to_mont(const uint128_t x) const noexcept
+    {
+        uint128_t high {};
+        const auto low {detail::umul_wide(x, r2_mod_m_, high)};
+        return redc(high, low);
+    }
+
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t from_mont(const uint128_t x) const noexcept
+    {
+        return redc(uint128_t{0}, x);
+    }
+
+    // The remaining operations expect their arguments in Montgomery form, and therefore less than m
+
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t mul(const uint128_t x, const uint128_t y) const noexcept
+    {
+        uint128_t high {};
+        const auto low {detail::umul_wide(x, y, high)};
+        return redc(high, low);
+    }
+
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t sqr(const uint128_t x) const noexcept
+    {
+        return mul(x, x);
+    }
+
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t add(const uint128_t x, const uint128_t y) const noexcept
+    {
+        // The sum can exceed 2^128 when m > 2^127, in which case it is certainly larger than m
+        uint128_t sum {};
+        const auto carry {ckd_add(&sum, x, y)};
+        const auto needs_reduction {static_cast<bool>(static_cast<unsigned>(carry) | static_cast<unsigned>(sum >= modulus_))};
+
+        return sum - (modulus_ & detail::select_mask(needs_reduction));
+    }
+
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t sub(const uint128_t x, const uint128_t y) const noexcept
+    {
+        return (x - y) + (modulus_ & detail::select_mask(x < y));
+    }
+};
+
+BOOST_INT128_EXPORT template <typename T>
+class barrett_reducer;
+
+// Reduction by a fixed modulus of any parity with the precomputed reciprocal mu = floor((2^256 - 1) / m).
+// This equals floor(2^256 / m) unless m is a power of two, and always fits in 256 bits.
+// Since mu >= 2^256 / m - 1 the quotient estimate floor(x * mu / 2^256) is at most one too small
+// for every 256-bit x, so a single conditional subtraction completes the reduction.
+BOOST_INT128_EXPORT template <>
+class barrett_reducer<uint128_t>
+{
+private:
+
+    uint128_t modulus_ {};
+    uint128_t mu_high_ {};
+    uint128_t mu_low_ {};
+
+    // When the quotient is known to fit into 128 bits (high < m) the top words of the products can be skipped
+    template <bool wide_quotient>
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t reduce_impl(const uint128_t high, const uint128_t low) const noexcept
+    {
+        // The upper 256 bits of the 512-bit product x * mu
+        uint128_t low_low_high {};
+        static_cast<void>(detail::umul_wide(low, mu_low_, low_low_high));
+
+        uint128_t low_high_high {};
+        const auto low_high_low {detail::umul_wide(low, mu_high_, low_high_high)};
+
+        uint128_t high_low_high {};
+        const auto high_low_low {detail::umul_wide(high, mu_low_, high_low_high)};
+
+        uint128_t high_high_high {};
+        uint128_t high_high_low {};
+
+        BOOST_INT128_IF_CONSTEXPR (wide_quotient)
+        {
+            high_high_low = detail::umul_wide(high, mu_high_, high_high_high);
+        }
+        else
+        {
+            high_high_low = high * mu_high_;
+        }
+
+        uint128_t middle {};
+        auto carries {static_cast<std::uint64_t>(ckd_add(&middle, low_low_high, low_high_low))};
+        carries += static_cast<std::uint64_t>(ckd_add(&middle, middle, high_low_low));
+
+        uint128_t quotient_low {};
+        auto quotient_carries {static_cast<std::uint64_t>(ckd_add(&quotient_low, low_high_high, high_low_high))};
+        quotient_carries += static_cast<std::uint64_t>(ckd_add(&quotient_low, quotient_low, high_high_low));
+        quotient_carries += static_cast<std::uint64_t>(ckd_add(&quotient_low, quotient_low, uint128_t{carries}));
+
+        // Only the low 256 bits of q * m are needed since x - q * m < 2m
+        uint128_t product_high {};
+        const auto product_low {detail::umul_wide(quotient_low, modulus_, product_high)};
+
+        BOOST_INT128_IF_CONSTEXPR (wide_quotient)
+        {
+            const auto quotient_high {high_high_high + quotient_carries};
+            product_high += quotient_high * modulus_;
+        }
+        else
+        {
+            static_cast<void>(quotient_carries);
+        }
+
+        // The remainder can need 129 bits when m > 2^127, so track the bit above the low word
+        const auto remainder {low - product_low};
+        const auto remainder_high {high - product_high - static_cast<std::uint64_t>(low < product_low)};
+        const auto needs_reduction {static_cast<bool>(static_cast<unsigned>(remainder_high != 0U) | static_cast<unsigned>(remainder >= modulus_))};
+
+        return remainder - (modulus_ & detail::select_mask(needs_reduction));
+    }
+
+public:
+
+    explicit constexpr barrett_reducer(const uint128_t m) noexcept : modulus_ {m}
+    {
+        BOOST_INT128_ASSERT_MSG(m != 0U, "The modulus must not be zero");
+
+        // Schoolbook division of 2^256 - 1 by m, one 128-bit quotient word at a time
+        constexpr auto max_word {(std::numeric_limits<uint128_t>::max)()};
+
+        mu_high_ = max_word / m;
+        const auto high_remainder {max_word - mu_high_ * m};
+
+        uint128_t remainder {};
+        mu_low_ = detail::knuth_div_wide(high_remainder, max_word, m, remainder);
+    }
+
+    constexpr uint128_t modulus() const noexcept { return modulus_; }
+
+    // (high * 2^128 + low) mod m for any 256-bit value
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t reduce(const uint128_t high, const uint128_t low) const noexcept
+    {
+        return reduce_impl<true>(high, low);
+    }
+
+    // The remaining operations expect their arguments to be less than m
+
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t mulmod(const uint128_t x, const uint128_t y) const noexcept
+    {
+        // x * y < m^2 so the quotient fits into 128 bits
+        uint128_t high {};
+        const auto low {detail::umul_wide(x, y, high)};
+        return reduce_impl<false>(high, low);
+    }
+
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t addmod(const uint128_t x, const uint128_t y) const noexcept
+    {
+        uint128_t sum {};
+        const auto carry {ckd_add(&sum, x, y)};
+        const auto needs_reduction {static_cast<bool>(static_cast<unsigned>(carry) | static_cast<unsigned>(sum >= modulus_))};
+
+        return sum - (modulus_ & detail::select_mask(needs_reduction));
+    }
+
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t submod(const uint128_t x, const uint128_t y) const noexcept
+    {
+        return (x - y) + (modulus_ & detail::select_mask(x < y));
+    }
+};
+
+namespace detail {
+
+// Each backend keeps its residues in whatever form is cheapest to multiply,
+// and converts in and out of that form once per exponentiation
+
+// Moduli that fit into 64 bits use the 2-by-1 division of Moller and Granlund with a precomputed reciprocal
+class powm64_backend
+{
+private:
+
+    std::uint64_t divisor_ {};      // The modulus normalized so that its most significant bit is set
+    std::uint64_t reciprocal_ {};
+    int shift_ {};
+
+    BOOST_INT128_FORCE_INLINE constexpr std::uint64_t reduce(const std::uint64_t high, const std::uint64_t low) const noexcept
+    {
+        // Requires high * 2^64 + low < m * 2^64 so that the normalized high word is less than the divisor
+        const auto u1 {shift_ == 0 ? high : (high << shift_) | (low >> (64 - shift_))};
+        const auto u0 {low << shift_};
+
+        std::uint64_t remainder {};
+        static_cast<void>(impl::div_2by1(u1, u0, divisor_, reciprocal_, remainder));
+        return remainder >> shift_;
+    }
+
+public:
+
+    using value_type = std::uint64_t;
+
+    explicit constexpr powm64_backend(const std::uint64_t m) noexcept :
+        divisor_ {m << countl_zero(m)}, reciprocal_ {impl::reciprocal_word(m << countl_zero(m))}, shift_ {countl_zero(m)} {}
+
+    constexpr value_type one() const noexcept { return 1U; }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type to(const uint128_t x) const noexcept
+    {
+        return reduce(reduce(0U, x.high), x.low);
+    }
+
+    constexpr uint128_t from(const value_type x) const noexcept { return uint128_t{x}; }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type mul(const value_type x, const value_type y) const noexcept
+    {
+        std::uint64_t high {};
+        const auto low {umul64(x, y, high)};
+        return reduce(high, low);
+    }
+};
+
+class montgomery_backend
+{
+private:
+
+    montgomery_context<uint128_t> context_;
+
+public:
+
+    using value_type = uint128_t;
+
+    explicit constexpr montgomery_backend(const uint128_t m) noexcept : context_ {m} {}
+
+    constexpr value_type one() const noexcept { return context_.one(); }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type to(const uint128_t x) const noexcept { return context_.to_mont(x); }
+
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t from(const value_type x) const noexcept { return context_.from_mont(x); }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type mul(const value_type x, const value_type y) const noexcept { return context_.mul(x, y); }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type add(const value_type x, const value_type y) const noexcept { return context_.add(x, y); }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type sub(const value_type x, const value_type y) const noexcept { return context_.sub(x, y); }
+
+    constexpr uint128_t modulus() const noexcept { return context_.modulus(); }
+};
+
+class barrett_backend
+{
+private:
+
+    barrett_reducer<uint128_t> reducer_;
+
+public:
+
+    using value_type = uint128_t;
+
+    explicit constexpr barrett_backend(const uint128_t m) noexcept : reducer_ {m} {}
+
+    constexpr value_type one() const noexcept { return value_type{1}; }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type to(const uint128_t x) const noexcept { return reducer_.reduce(uint128_t{0}, x); }
+
+    constexpr uint128_t from(const value_type x) const noexcept { return x; }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type mul(const value_type x, const value_type y) const noexcept { return reducer_.mulmod(x, y); }
+};
+
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t exponent_bits(const uint128_t exp, const int low, const int count) noexcept
+{
+    return (exp >> low).low & ((UINT64_C(1) << count) - 1U);
+}
+
+// Window width that minimizes squarings plus table multiplications for an exponent of the given width.
+// The table holds the odd powers base^1, base^3, ..., base^(2^width - 1).
+constexpr int powm_window_width(const int bits) noexcept
+{
+    return bits <= 8 ? 1 : bits <= 24 ? 2 : bits <= 64 ? 3 : 4;
+}
+
+BOOST_INT128_INLINE_CONSTEXPR std::size_t powm_table_size {8};
+
+// Number of exponentiations interleaved by the batched functions
+BOOST_INT128_INLINE_CONSTEXPR std::size_t powm_lanes {4};
+
+// Left-to-right sliding window exponentiation of several bases by the same exponent.
+// The lanes are independent, so interleaving them hides the latency of each modular multiplication.
+template <std::size_t lanes, typename Backend>
+constexpr void sliding_window_powm(const Backend& backend, const uint128_t* bases, const uint128_t exp, uint128_t* results) noexcept
+{
+    using value_type = typename Backend::value_type;
+
+    if (exp == 0U)
+    {
+        for (std::size_t lane {}; lane < lanes; ++lane)
+        {
+            results[lane] = backend.from(backend.one());
+        }
+
+        return;
+    }
+
+    const auto bits {bit_width(exp)};
+    const auto window {powm_window_width(bits)};
+    const auto table_size {static_cast<std::size_t>(1) << (window - 1)};
+
+    value_type table[powm_table_size][lanes] {};
+    value_type result[lanes] {};
+
+    for (std::size_t lane {}; lane < lanes; ++lane)
+    {
+        table[0][lane] = backend.to(bases[lane]);
+    }
+
+    if (table_size > 1U)
+    {
+        value_type base_squared[lanes] {};
+        for (std::size_t lane {}; lane < lanes; ++lane)
+        {
+            base_squared[lane] = backend.mul(table[0][lane], table[0][lane]);
+        }
+
+        for (std::size_t i {1}; i < table_size; ++i)
+        {
+            for (std::size_t lane {}; lane < lanes; ++lane)
+            {
+                table[i][lane] = backend.mul(table[i - 1U][lane], base_squared[lane]);
+            }
+        }
+    }
+
+    // The leading bit is set, so the first window starts the result without squaring one
+    bool first_window {true};
+    auto i {bits - 1};
+    while (i >= 0)
+    {
+        if (exponent_bits(exp, i, 1) == 0U)
+        {
+            for (std::size_t lane {}; lane < lanes; ++lane)
+            {
+                result[lane] = backend.mul(result[lane], result[lane]);
+            }
+
+            --i;
+            continue;
+        }
+
+        // Shrink the window until it ends in a set bit, so that only odd powers are needed
+        auto low {i - window + 1 < 0 ? 0 : i - window + 1};
+        while (exponent_bits(exp, low, 1) == 0U)
+        {
+            ++low;
+        }
+
+        const auto length {i - low + 1};
+        const auto index {static_cast<std::size_t>(exponent_bits(exp, low, length) >> 1U)};
+
+        if (first_window)
+        {
+            for (std::size_t lane {}; lane < lanes; ++lane)
+            {
+                result[lane] = table[index][lane];
+            }
+
+            first_window = false;
+        }
+        else
+        {
+            for (int j {}; j < length; ++j)
+            {
+                for (std::size_t lane {}; lane < lanes; ++lane)
+                {
+                    result[lane] = backend.mul(result[lane], result[lane]);
+                }
+            }
+
+            for (std::size_t lane {}; lane < lanes; ++lane)
+            {
+                result[lane] = backend.mul(result[lane], table[index][lane]);
+            }
+        }
+
+        i = low - 1;
+    }
+
+    for (std::size_t lane {}; lane < lanes; ++lane)
+    {
+        results[lane] = backend.from(result[lane]);
+    }
+}
+
+// Each lane has its own exponent, so the lanes follow fixed 4-bit windows to stay in step
+template <typename Backend>
+void fixed_window_powm(const Backend& backend, const uint128_t* bases, const uint128_t* exps, uint128_t* results) noexcept
+{
+    using value_type = typename Backend::value_type;
+
+    constexpr int window {4};
+    constexpr std::size_t table_size {static_cast<std::size_t>(1) << window};
+
+    value_type table[table_size][powm_lanes] {};
+    value_type result[powm_lanes] {};
+    int bits {};
+
+    for (std::size_t lane {}; lane < powm_lanes; ++lane)
+    {
+        table[0][lane] = backend.one();
+        table[1][lane] = backend.to(bases[lane]);
+        result[lane] = backend.one();
+
+        const auto lane_bits {bit_width(exps[lane])};
+        bits = lane_bits > bits ? lane_bits : bits;
+    }
+
+    for (std::size_t i {2}; i < table_size; ++i)
+    {
+        for (std::size_t lane {}; lane < powm_lanes; ++lane)
+        {
+            table[i][lane] = backend.mul(table[i - 1U][lane], table[1][lane]);
+        }
+    }
+
+    for (auto low {(bits + window - 1) / window * window - window}; low >= 0; low -= window)
+    {
+        for (int j {}; j < window; ++j)
+        {
+            for (std::size_t lane {}; lane < powm_lanes; ++lane)
+            {
+                result[lane] = backend.mul(result[lane], result[lane]);
+            }
+        }
+
+        for (std::size_t lane {}; lane < powm_lanes; ++lane)
+        {
+            const auto digit {static_cast<std::size_t>(exponent_bits(exps[lane], low, window))};
+            if (digit != 0U)
+            {
+                result[lane] = backend.mul(result[lane], table[digit][lane]);
+            }
+        }
+    }
+
+    for (std::size_t lane {}; lane < powm_lanes; ++lane)
+    {
+        results[lane] = backend.from(result[lane]);
+    }
+}
+
+template <typename Backend>
+void powm_n_impl(const Backend& backend, const uint128_t* bases, const std::size_t n, const uint128_t exp, uint128_t* out) noexcept
+{
+    std::size_t i {};
+    for (; i + powm_lanes <= n; i += powm_lanes)
+    {
+        sliding_window_powm<powm_lanes>(backend, bases + i, exp, out + i);
+    }
+    for (; i < n; ++i)
+    {
+        sliding_window_powm<1>(backend, bases + i, exp, out + i);
+    }
+}
+
+template <typename Backend>
+void powm_n_impl(const Backend& backend, const uint128_t* bases, const uint128_t* exps, const std::size_t n, uint128_t* out) noexcept
+{
+    std::size_t i {};
+    for (; i + powm_lanes <= n; i += powm_lanes)
+    {
+        fixed_window_powm(backend, bases + i, exps + i, out + i);
+    }
+    for (; i < n; ++i)
+    {
+        sliding_window_powm<1>(backend, bases + i, exps[i], out + i);
+    }
+}
+
+} // namespace detail
+
+// Computes base^exp mod m with sliding window exponentiation.
+// The residue arithmetic is chosen by the modulus: 64-bit moduli use a precomputed reciprocal,
+// odd moduli use Montgomery multiplication, and even moduli use Barrett reduction.
+// A modulus of zero returns zero to match operator%.
+
+BOOST_INT128_EXPORT constexpr uint128_t powm(const uint128_t base, const uint128_t exp, const uint128_t m) noexcept
+{
+    if (m <= 1U)
+    {
+        return uint128_t{0};
+    }
+
+    uint128_t result {};
+
+    if (m.high == 0U)
+    {
+        detail::sliding_window_powm<1>(detail::powm64_backend{m.low}, &base, exp, &result);
+    }
+    else if ((m.low & 1U) == 1U)
+    {
+        detail::sliding_window_powm<1>(detail::montgomery_backend{m}, &base, exp, &result);
+    }
+    else
+    {
+        detail::sliding_window_powm<1>(detail::barrett_backend{m}, &base, exp, &result);
+    }
+
+    return result;
+}
+
+// Batched exponentiation of n bases with a shared modulus.
+// The backend is set up once, and groups of exponentiations are interleaved for throughput.
+
+BOOST_INT128_EXPORT inline void powm_n(const uint128_t* bases, const std::size_t n, const uint128_t exp, const uint128_t m, uint128_t* out) noexcept
+{
+    if (m <= 1U)
+    {
+        for (std::size_t i {}; i < n; ++i)
+        {
+            out[i] = uint128_t{0};
+        }
+    }
+    else if (m.high == 0U)
+    {
+        detail::powm_n_impl(detail::powm64_backend{m.low}, bases, n, exp, out);
+    }
+    else if ((m.low & 1U) == 1U)
+    {
+        detail::powm_n_impl(detail::montgomery_backend{m}, bases, n, exp, out);
+    }
+    else
+    {
+        detail::powm_n_impl(detail::barrett_backend{m}, bases, n, exp, out);
+    }
+}
+
+// Element-wise exponentiation bases[i]^exps[i] mod m
+
+BOOST_INT128_EXPORT inline void powm_n(const uint128_t* bases, const uint128_t* exps, const std::size_t n, const uint128_t m, uint128_t* out) noexcept
+{
+    if (m <= 1U)
+    {
+        for (std::size_t i {}; i < n; ++i)
+        {
+            out[i] = uint128_t{0};
+        }
+    }
+    else if (m.high == 0U)
+    {
+        detail::powm_n_impl(detail::powm64_backend{m.low}, bases, exps, n, out);
+    }
+    else if ((m.low & 1U) == 1U)
+    {
+        detail::powm_n_impl(detail::montgomery_backend{m}, bases, exps, n, out);
+    }
+    else
+    {
+        detail::powm_n_impl(detail::barrett_backend{m}, bases, exps, n, out);
+    }
+}
+
+
+namespace detail {
+
+// Whether r^n <= x, stopping as soon as the power exceeds x
+constexpr bool root_fits(const uint128_t r, const int n, const uint128_t x) noexcept
+{
+    if (r <= 1U)
+    {
+        return r <= x;
+    }
+
+    auto power {r};
+    for (int i {1}; i < n; ++i)
+    {
+        if (ckd_mul(&power, power, r) || power > x)
+        {
+            return false;
+        }
+    }
+
+    return power <= x;
+}
+
+// Moves an estimate that is off by a few units onto floor(x^(1/n))
+constexpr uint128_t correct_root(uint128_t r, const int n, const uint128_t x) noexcept
+{
+    while (!root_fits(r, n, x))
+    {
+        --r;
+    }
+
+    while (root_fits(r + 1U, n, x))
+    {
+        ++r;
+    }
+
+    return r;
+}
+
+// Builds floor(x^(1/n)) one bit at a time from the top, for constant evaluation
+constexpr uint128_t root_by_bits(const uint128_t x, const int n) noexcept
+{
+    uint128_t r {};
+    for (int bit {(bit_width(x) - 1) / n}; bit >= 0; --bit)
+    {
+        const auto candidate {r | (uint128_t{1} << bit)};
+        if (root_fits(candidate, n, x))
+        {
+            r = candidate;
+        }
+    }
+
+    return r;
+}
+
+// Bit i is set when i is a square modulo m (m <= 128)
+constexpr uint128_t square_residues(const unsigned m) noexcept
+{
+    uint128_t mask {};
+    for (unsigned i {}; i < m; ++i)
+    {
+        mask |= uint128_t{1} << (i * i % m);
+    }
+
+    return mask;
+}
+
+// Only 12/64, 16/63, 21/65, 9/17 and 49/97 of the residues are squares,
+// so together the filters pass about 1 in 270 non-squares
+BOOST_INT128_INLINE_CONSTEXPR uint128_t squares_mod_64 {square_residues(64U)};
+BOOST_INT128_INLINE_CONSTEXPR uint128_t squares_mod_63 {square_residues(63U)};
+BOOST_INT128_INLINE_CONSTEXPR uint128_t squares_mod_65 {square_residues(65U)};
+BOOST_INT128_INLINE_CONSTEXPR uint128_t squares_mod_17 {square_residues(17U)};
+BOOST_INT128_INLINE_CONSTEXPR uint128_t squares_mod_97 {square_residues(97U)};
+
+BOOST_INT128_FORCE_INLINE constexpr bool is_square_residue(const uint128_t mask, const std::uint64_t residue) noexcept
+{
+    return ((mask >> residue).low & 1U) != 0U;
+}
+
+// Exponents that is_perfect_power has to try besides 2
+BOOST_INT128_INLINE_CONSTEXPR int odd_prime_exponents[] {3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53,
+                                                         59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127};
+
+// Whether r^p == x, where comparing the low words first rules out
+// nearly every wrong candidate with a handful of 64-bit products
+constexpr bool is_exact_power(const std::uint64_t r, const int p, const uint128_t x) noexcept
+{
+    std::uint64_t low {1};
+    std::uint64_t base {r};
+    for (int e {p}; e != 0; e >>= 1)
+    {
+        if ((e & 1) != 0)
+        {
+            low *= base;
+        }
+
+        base *= base;
+    }
+
+    if (low != x.low)
+    {
+        return false;
+    }
+
+    uint128_t power {1};
+    for (int i {}; i < p; ++i)
+    {
+        if (ckd_mul(&power, power, uint128_t{r}))
+        {
+            return false;
+        }
+    }
+
+    return power == x;
+}
+
+// Roots of degree three and above are below 2^43, where rounding exp2(log2(x) / p)
+// is accurate enough that the nearest integer is the only candidate
+inline bool has_odd_prime_root(const uint128_t x, const int twos, const int bits) noexcept
+{
+    const auto log2_x {std::log2(static_cast<double>(x))};
+    for (const auto p : odd_prime_exponents)
+    {
+        if (p >= bits)
+        {
+            break;
+        }
+
+        if (twos % p == 0)
+        {
+            const auto root {static_cast<std::uint64_t>(std::exp2(log2_x / static_cast<double>(p)) + 0.5)};
+            if (is_exact_power(root, p, x))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+inline std::uint64_t isqrt64(const std::uint64_t x) noexcept
+{
+    // Rounding x and its root to double leaves the truncated result within one of the answer
+    auto r {static_cast<std::uint64_t>(std::sqrt(static_cast<double>(x)))};
+    if (r > UINT32_MAX)
+    {
+        r = UINT32_MAX;
+    }
+
+    if (r * r > x)
+    {
+        --r;
+    }
+    else if (r < UINT32_MAX && (r + 1U) * (r + 1U) <= x)
+    {
+        ++r;
+    }
+
+    return r;
+}
+
+inline uint128_t isqrt_runtime(const uint128_t x) noexcept
+{
+    if (x.high == 0U)
+    {
+        return uint128_t{isqrt64(x.low)};
+    }
+
+    // The double seed carries the top 53 bits of the root, so a single Newton step
+    // lands on the floor of the root or one above it
+    const auto seed {std::sqrt(static_cast<double>(x))};
+    uint128_t r {seed >= 18446744073709551615.0 ? UINT64_MAX : static_cast<std::uint64_t>(seed)};
+    r = (r + x / r) >> 1U;
+
+    if (r.high != 0U)
+    {
+        r = uint128_t{UINT64_MAX};
+    }
+
+    if (r * r > x)
+    {
+        --r;
+    }
+
+    return r;
+}
+
+} // namespace detail
+
+// Floor of the square root of x
+
+BOOST_INT128_EXPORT constexpr uint128_t isqrt(const uint128_t x) noexcept
+{
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(x))
+    {
+        return detail::isqrt_runtime(x);
+    }
+
+    #endif
+
+    if (x < 2U)
+    {
+        return x;
+    }
+
+    // Newton's iteration decreases monotonically from any starting point above the root
+    auto r {uint128_t{1} << ((bit_width(x) + 1) / 2)};
+    while (true)
+    {
+        const auto next {(r + x / r) >> 1U};
+        if (next >= r)
+        {
+            return r;
+        }
+
+        r = next;
+    }
+}
+
+// Floor of the cube root of x
+
+BOOST_INT128_EXPORT constexpr uint128_t icbrt(const uint128_t x) noexcept
+{
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(x))
+    {
+        const auto seed {static_cast<std::uint64_t>(std::cbrt(static_cast<double>(x)))};
+        return detail::correct_root(uint128_t{seed}, 3, x);
+    }
+
+    #endif
+
+    return detail::root_by_bits(x, 3);
+}
+
+// Floor of the nth root of x for n >= 1
+
+BOOST_INT128_EXPORT constexpr uint128_t iroot(const uint128_t x, const int n) noexcept
+{
+    BOOST_INT128_ASSERT_MSG(n >= 1, "The degree of the root must be at least 1");
+
+    if (n <= 1 || x < 2U)
+    {
+        return x;
+    }
+    if (n == 2)
+    {
+        return isqrt(x);
+    }
+    if (n == 3)
+    {
+        return icbrt(x);
+    }
+
+    // x < 2^n so the root is below 2
+    if (n >= bit_width(x))
+    {
+        return uint128_t{1};
+    }
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(x))
+    {
+        const auto seed {static_cast<std::uint64_t>(std::pow(static_cast<double>(x), 1.0 / static_cast<double>(n)))};
+        return detail::correct_root(uint128_t{seed}, n, x);
+    }
+
+    #endif
+
+    return detail::root_by_bits(x, n);
+}
+
+BOOST_INT128_EXPORT constexpr bool is_perfect_square(const uint128_t x) noexcept
+{
+    if (!detail::is_square_residue(detail::squares_mod_64, x.low & 63U))
+    {
+        return false;
+    }
+
+    // Summing the 48-bit chunks gives a value congruent to x modulo 2^48 - 1,
+    // which is divisible by 63, 65, 17 and 97
+    constexpr std::uint64_t chunk_mask {(UINT64_C(1) << 48U) - 1U};
+    const auto residue {(x.low & chunk_mask) +
+                        ((x.low >> 48U) | ((x.high & UINT32_MAX) << 16U)) +
+                        (x.high >> 32U)};
+
+    if (!detail::is_square_residue(detail::squares_mod_63, residue % 63U) ||
+        !detail::is_square_residue(detail::squares_mod_65, residue % 65U) ||
+        !detail::is_square_residue(detail::squares_mod_17, residue % 17U) ||
+        !detail::is_square_residue(detail::squares_mod_97, residue % 97U))
+    {
+        return false;
+    }
+
+    const auto root {isqrt(x)};
+    return root * root == x;
+}
+
+// Whether x = a^k for some a and k >= 2, where 0 and 1 count as perfect powers
+
+BOOST_INT128_EXPORT constexpr bool is_perfect_power(const uint128_t x) noexcept
+{
+    if (x < 4U)
+    {
+        return x < 2U;
+    }
+
+    if (is_perfect_square(x))
+    {
+        return true;
+    }
+
+    // A composite exponent implies a prime one, and every prime exponent
+    // has to divide the multiplicity of the factor 2
+    const auto twos {countr_zero(x)};
+    const auto bits {bit_width(x)};
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+    if (!BOOST_INT128_IS_CONSTANT_EVALUATED(x))
+    {
+        return detail::has_odd_prime_root(x, twos, bits);
+    }
+
+    #endif
+
+    for (const auto p : detail::odd_prime_exponents)
+    {
+        if (p >= bits)
+        {
+            break;
+        }
+
+        if (twos % p == 0 && detail::is_exact_power(iroot(x, p).low, p, x))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 } // namespace int128
 } // namespace boost
 
@@ -0,0 +1,612 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_INT128_PRIME_HPP
+#define BOOST_INT128_PRIME_HPP
+
+#include <boost/int128/int128.hpp>
+#include <boost/int128/bit.hpp>
+#include <boost/int128/numeric.hpp>
+#include <boost/int128/detail/config.hpp>
+#include <boost/int128/detail/common_mul.hpp>
+
+#ifndef BOOST_INT128_BUILD_MODULE
+
+#include <cstddef>
+#include <cstdint>
+
+#endif
+
+namespace boost {
+namespace int128 {
+
+namespace detail {
+
+// The odd primes below 2^8, 3 through 251, which are tested by exact division before anything more expensive.
+// p divides x if and only if x * p^-1 mod 2^64 <= (2^64 - 1) / p
+struct trial_prime
+{
+    std::uint64_t prime;
+    std::uint64_t inverse;
+    std::uint64_t limit;
+};
+
+constexpr trial_prime make_trial_prime(const std::uint64_t p) noexcept
+{
+    return {p, inverse_mod_2_64(p), UINT64_MAX / p};
+}
+
+BOOST_INT128_INLINE_CONSTEXPR trial_prime trial_primes[] {
+    make_trial_prime(3U), make_trial_prime(5U), make_trial_prime(7U), make_trial_prime(11U), make_trial_prime(13U),
+    make_trial_prime(17U), make_trial_prime(19U), make_trial_prime(23U), make_trial_prime(29U), make_trial_prime(31U),
+    make_trial_prime(37U), make_trial_prime(41U), make_trial_prime(43U), make_trial_prime(47U), make_trial_prime(53U),
+    make_trial_prime(59U), make_trial_prime(61U), make_trial_prime(67U), make_trial_prime(71U), make_trial_prime(73U),
+    make_trial_prime(79U), make_trial_prime(83U), make_trial_prime(89U), make_trial_prime(97U), make_trial_prime(101U),
+    make_trial_prime(103U), make_trial_prime(107U), make_trial_prime(109U), make_trial_prime(113U), make_trial_prime(127U),
+    make_trial_prime(131U), make_trial_prime(137U), make_trial_prime(139U), make_trial_prime(149U),
+    make_trial_prime(151U), make_trial_prime(157U), make_trial_prime(163U), make_trial_prime(167U), make_trial_prime(173U),
+    make_trial_prime(179U), make_trial_prime(181U), make_trial_prime(191U),
+    make_trial_prime(193U), make_trial_prime(197U), make_trial_prime(199U), make_trial_prime(211U), make_trial_prime(223U),
+    make_trial_prime(227U), make_trial_prime(229U), make_trial_prime(233U), make_trial_prime(239U), make_trial_prime(241U),
+    make_trial_prime(251U)
+};
+
+// Every value below the square of the next prime that has no factor in the table is prime
+BOOST_INT128_INLINE_CONSTEXPR std::uint64_t trial_bound {257U * 257U};
+
+constexpr std::uint64_t trial_product(const std::size_t first, const std::size_t last) noexcept
+{
+    std::uint64_t product {1};
+    for (auto i {first}; i < last; ++i)
+    {
+        product *= trial_primes[i].prime;
+    }
+
+    return product;
+}
+
+// Consecutive runs of the table whose product fits into a word, so that a value wider than
+// a word needs a single narrow division per run and the tests themselves are all 64-bit
+struct trial_group
+{
+    std::uint64_t product;
+    std::size_t first;
+    std::size_t last;
+};
+
+BOOST_INT128_INLINE_CONSTEXPR trial_group trial_groups[] {
+    {trial_product(0U, 15U), 0U, 15U},
+    {trial_product(15U, 25U), 15U, 25U},
+    {trial_product(25U, 34U), 25U, 34U},
+    {trial_product(34U, 42U), 34U, 42U},
+    {trial_product(42U, 50U), 42U, 50U},
+    {trial_product(50U, 53U), 50U, 53U}
+};
+
+// A residue of n that has the same divisors in the group as n itself
+BOOST_INT128_FORCE_INLINE constexpr std::uint64_t trial_residue(const uint128_t n, const trial_group& group) noexcept
+{
+    return n.high == 0U ? n.low : (n % group.product).low;
+}
+
+BOOST_INT128_FORCE_INLINE constexpr bool divides(const trial_prime& p, const std::uint64_t residue) noexcept
+{
+    return residue * p.inverse <= p.limit;
+}
+
+// Whether n has a factor in the table, where n is larger than every prime in the table
+constexpr bool has_trial_factor(const uint128_t n) noexcept
+{
+    for (const auto& group : trial_groups)
+    {
+        const auto residue {trial_residue(n, group)};
+        for (auto i {group.first}; i < group.last; ++i)
+        {
+            if (divides(trial_primes[i], residue))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Montgomery arithmetic modulo an odd m < 2^64 with R = 2^64, providing the same interface as montgomery_backend
+class montgomery64_backend
+{
+private:
+
+    std::uint64_t modulus_ {};
+    std::uint64_t inverse_ {};    // m^-1 mod R
+    std::uint64_t r_mod_m_ {};
+    std::uint64_t r2_mod_m_ {};
+
+    BOOST_INT128_FORCE_INLINE constexpr std::uint64_t redc(const std::uint64_t high, const std::uint64_t low) const noexcept
+    {
+        std::uint64_t um_high {};
+        static_cast<void>(umul64(low * inverse_, modulus_, um_high));
+
+        const auto res {high - um_high};
+        return high < um_high ? res + modulus_ : res;
+    }
+
+public:
+
+    using value_type = std::uint64_t;
+
+    explicit constexpr montgomery64_backend(const std::uint64_t m) noexcept : modulus_ {m}, inverse_ {inverse_mod_2_64(m)}
+    {
+        r_mod_m_ = (UINT64_C(0) - m) % m;
+
+        std::uint64_t high {};
+        const auto low {umul64(r_mod_m_, r_mod_m_, high)};
+        r2_mod_m_ = (uint128_t{high, low} % m).low;
+    }
+
+    constexpr value_type one() const noexcept { return r_mod_m_; }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type to(const uint128_t x) const noexcept
+    {
+        return mul((x % modulus_).low, r2_mod_m_);
+    }
+
+    BOOST_INT128_FORCE_INLINE constexpr uint128_t from(const value_type x) const noexcept
+    {
+        return uint128_t{redc(0U, x)};
+    }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type mul(const value_type x, const value_type y) const noexcept
+    {
+        std::uint64_t high {};
+        const auto low {umul64(x, y, high)};
+        return redc(high, low);
+    }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type add(const value_type x, const value_type y) const noexcept
+    {
+        // Compares against m - y instead of forming x + y, which can overflow when m > 2^63
+        const auto gap {modulus_ - y};
+        return x >= gap ? x - gap : x + y;
+    }
+
+    BOOST_INT128_FORCE_INLINE constexpr value_type sub(const value_type x, const value_type y) const noexcept
+    {
+        return x < y ? x - y + modulus_ : x - y;
+    }
+
+    constexpr uint128_t modulus() const noexcept { return uint128_t{modulus_}; }
+};
+
+// x / 2 mod m for odd m. Halving is linear, so it applies unchanged to Montgomery representations.
+template <typename Backend>
+BOOST_INT128_FORCE_INLINE constexpr typename Backend::value_type halve(const Backend& backend, const typename Backend::value_type x) noexcept
+{
+    using value_type = typename Backend::value_type;
+
+    // For odd x, (x + m) / 2 is computed as x / 2 + m / 2 + 1 to avoid overflow
+    const auto half_modulus {static_cast<value_type>(backend.modulus() >> 1U)};
+    return (static_cast<std::uint64_t>(x) & 1U) == 1U ? (x >> 1U) + half_modulus + 1U : x >> 1U;
+}
+
+template <typename Backend>
+constexpr typename Backend::value_type to_signed_residue(const Backend& backend, const std::int64_t x) noexcept
+{
+    using value_type = typename Backend::value_type;
+
+    const auto magnitude {backend.to(uint128_t{x < 0 ? UINT64_C(0) - static_cast<std::uint64_t>(x) : static_cast<std::uint64_t>(x)})};
+    return x < 0 ? backend.sub(value_type{0}, magnitude) : magnitude;
+}
+
+// Strong probable prime test to the given base for odd n > base
+template <typename Backend>
+constexpr bool miller_rabin(const Backend& backend, const uint128_t n, const uint128_t base) noexcept
+{
+    using value_type = typename Backend::value_type;
+
+    const auto n_minus_one {n - 1U};
+    const auto s {countr_zero(n_minus_one)};
+
+    uint128_t x {};
+    sliding_window_powm<1>(backend, &base, n_minus_one >> s, &x);
+
+    if (x == 1U || x == n_minus_one)
+    {
+        return true;
+    }
+
+    const value_type minus_one {backend.to(n_minus_one)};
+    value_type y {backend.to(x)};
+
+    for (int i {1}; i < s; ++i)
+    {
+        y = backend.mul(y, y);
+        if (y == minus_one)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Jacobi symbol (x / a) for odd a
+constexpr int jacobi(std::uint64_t x, std::uint64_t a) noexcept
+{
+    int result {1};
+    x %= a;
+
+    while (x != 0U)
+    {
+        const auto zeros {countr_zero(x)};
+        x >>= zeros;
+
+        // (2 / a) is -1 when a is 3 or 5 mod 8
+        if ((zeros & 1) == 1 && ((a & 7U) == 3U || (a & 7U) == 5U))
+        {
+            result = -result;
+        }
+
+        // Quadratic reciprocity for odd x and a
+        if ((x & 3U) == 3U && (a & 3U) == 3U)
+        {
+            result = -result;
+        }
+
+        const auto temp {x};
+        x = a % temp;
+        a = temp;
+    }
+
+    return a == 1U ? result : 0;
+}
+
+// Jacobi symbol (d / n) for odd n larger than |d|, reduced to a word sized symbol by reciprocity
+constexpr int jacobi(const std::int64_t d, const uint128_t n) noexcept
+{
+    const auto a {d < 0 ? UINT64_C(0) - static_cast<std::uint64_t>(d) : static_cast<std::uint64_t>(d)};
+
+    auto result {jacobi((n % a).low, a)};
+
+    if ((a & 3U) == 3U && (n.low & 3U) == 3U)
+    {
+        result = -result;
+    }
+
+    // (-1 / n) is -1 when n is 3 mod 4
+    if (d < 0 && (n.low & 3U) == 3U)
+    {
+        result = -result;
+    }
+
+    return result;
+}
+
+// Strong Lucas probable prime test with the parameters of Selfridge's method A
+// (the first D in 5, -7, 9, -11, ... with (D / n) == -1, P = 1 and Q = (1 - D) / 4)
+// for odd n without small factors.
+// See: R. Baillie and S. Wagstaff, Lucas Pseudoprimes, 1980
+template <typename Backend>
+constexpr bool strong_lucas(const Backend& backend, const uint128_t n) noexcept
+{
+    using value_type = typename Backend::value_type;
+
+    std::int64_t d {5};
+    for (int attempt {};; ++attempt)
+    {
+        const auto symbol {jacobi(d, n)};
+        if (symbol == -1)
+        {
+            break;
+        }
+
+        // |d| < n shares a factor with n
+        if (symbol == 0)
+        {
+            return false;
+        }
+
+        // No suitable D exists when n is a square, which is only worth checking once the search takes a while
+        if (attempt == 8)
+        {
+            if (is_perfect_square(n))
+            {
+                return false;
+            }
+        }
+
+        d = d > 0 ? -(d + 2) : -(d - 2);
+    }
+
+    const auto d_residue {to_signed_residue(backend, d)};
+    const auto q_residue {to_signed_residue(backend, (1 - d) / 4)};
+
+    // n + 1 == k * 2^s with k odd. n is not 2^128 - 1 since it has no factor of 3.
+    const auto n_plus_one {n + 1U};
+    const auto s {countr_zero(n_plus_one)};
+    const auto k {n_plus_one >> s};
+
+    // Left-to-right ladder for U_j, V_j and Q^j starting from j = 1
+    value_type u {backend.one()};
+    value_type v {backend.one()};
+    value_type q_power {q_residue};
+
+    for (int bit {bit_width(k) - 2}; bit >= 0; --bit)
+    {
+        // j -> 2j
+        u = backend.mul(u, v);
+        v = backend.sub(backend.mul(v, v), backend.add(q_power, q_power));
+        q_power = backend.mul(q_power, q_power);
+
+        // j -> j + 1
+        if (((k >> bit).low & 1U) == 1U)
+        {
+            const auto next_u {halve(backend, backend.add(u, v))};
+            v = halve(backend, backend.add(backend.mul(d_residue, u), v));
+            u = next_u;
+            q_power = backend.mul(q_power, q_residue);
+        }
+    }
+
+    if (u == value_type{0} || v == value_type{0})
+    {
+        return true;
+    }
+
+    for (int r {1}; r < s; ++r)
+    {
+        v = backend.sub(backend.mul(v, v), backend.add(q_power, q_power));
+        q_power = backend.mul(q_power, q_power);
+
+        if (v == value_type{0})
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename Backend>
+constexpr bool baillie_psw(const Backend& backend, const uint128_t n) noexcept
+{
+    return miller_rabin(backend, n, uint128_t{2}) && strong_lucas(backend, n);
+}
+
+// Number of polynomial steps between the gcds of Brent's variant of Pollard's rho
+BOOST_INT128_INLINE_CONSTEXPR std::size_t pollard_batch {128};
+
+// Returns a non-trivial factor of the odd composite n, or n itself if the walk x -> x^2 + c failed.
+// The walk stays in Montgomery form: residues only differ from the plain values by a unit,
+// which changes neither the collisions modulo a factor nor the gcds with n.
+// See: R. Brent, An Improved Monte Carlo Factorization Algorithm, 1980
+template <typename Backend>
+constexpr uint128_t pollard_brent(const Backend& backend, const std::uint64_t c_value) noexcept
+{
+    using value_type = typename Backend::value_type;
+
+    const auto n {backend.modulus()};
+    const auto c {backend.to(uint128_t{c_value})};
+
+    value_type x {};
+    value_type y {backend.one()};
+    value_type saved_y {};
+    value_type product {backend.one()};
+    uint128_t g {1};
+
+    for (std::size_t r {1}; g == 1U; r *= 2U)
+    {
+        x = y;
+        for (std::size_t i {}; i < r; ++i)
+        {
+            y = backend.add(backend.mul(y, y), c);
+        }
+
+        // The products of |x - y| are batched so that one gcd covers many steps
+        for (std::size_t k {}; k < r && g == 1U; k += pollard_batch)
+        {
+            saved_y = y;
+
+            const auto steps {r - k < pollard_batch ? r - k : pollard_batch};
+            for (std::size_t i {}; i < steps; ++i)
+            {
+                y = backend.add(backend.mul(y, y), c);
+                product = backend.mul(product, backend.sub(x, y));
+            }
+
+            g = gcd(uint128_t{product}, n);
+        }
+    }
+
+    // Every factor collided within the last batch, so step through it one gcd at a time
+    if (g == n)
+    {
+        do
+        {
+            saved_y = backend.add(backend.mul(saved_y, saved_y), c);
+            g = gcd(uint128_t{backend.sub(x, saved_y)}, n);
+        } while (g == 1U);
+    }
+
+    return g;
+}
+
+constexpr uint128_t find_factor(const uint128_t n) noexcept
+{
+    for (std::uint64_t c {1};; ++c)
+    {
+        const auto factor {n.high == 0U ? pollard_brent(montgomery64_backend{n.low}, c) : pollard_brent(montgomery_backend{n}, c)};
+        if (factor != n)
+        {
+            return factor;
+        }
+    }
+}
+
+// Values without small factors have at most 16 prime factors, since each of them is larger than 2^7
+BOOST_INT128_INLINE_CONSTEXPR std::size_t max_large_prime_factors {16};
+
+// The product of the 27 smallest primes exceeds 2^128
+BOOST_INT128_INLINE_CONSTEXPR std::size_t max_distinct_prime_factors {26};
+
+} // namespace detail
+
+// Deterministic for every n < 2^64. Larger values that pass have no known counterexample,
+// since no composite that passes the Baillie-PSW test has ever been found.
+BOOST_INT128_EXPORT constexpr bool is_prime(const uint128_t n) noexcept
+{
+    if (n < 4U)
+    {
+        return n >= 2U;
+    }
+    if ((n.low & 1U) == 0U)
+    {
+        return false;
+    }
+
+    if (n < detail::trial_bound)
+    {
+        for (const auto& p : detail::trial_primes)
+        {
+            if (n.low == p.prime)
+            {
+                return true;
+            }
+            if (detail::divides(p, n.low))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    if (detail::has_trial_factor(n))
+    {
+        return false;
+    }
+
+    return n.high == 0U ? detail::baillie_psw(detail::montgomery64_backend{n.low}, n) :
+                          detail::baillie_psw(detail::montgomery_backend{n}, n);
+}
+
+BOOST_INT128_EXPORT struct prime_factor
+{
+    uint128_t prime;
+    int multiplicity;
+};
+
+// The distinct prime factors in ascending order
+BOOST_INT128_EXPORT struct factorization_result
+{
+    prime_factor factors[detail::max_distinct_prime_factors];
+    std::size_t size;
+
+    constexpr const prime_factor* begin() const noexcept { return factors; }
+    constexpr const prime_factor* end() const noexcept { return factors + size; }
+};
+
+// Factors below 2^8 are removed by trial division with exact division tests,
+// the remaining cofactor is split with Pollard's rho until every part passes is_prime.
+// The running time grows with the square root of the second largest prime factor.
+// 0 and 1 have no prime factors.
+BOOST_INT128_EXPORT constexpr factorization_result factorize(uint128_t n) noexcept
+{
+    factorization_result result {};
+
+    if (n < 2U)
+    {
+        return result;
+    }
+
+    const auto twos {countr_zero(n)};
+    if (twos > 0)
+    {
+        result.factors[result.size++] = {uint128_t{2}, twos};
+        n >>= twos;
+    }
+
+    for (const auto& group : detail::trial_groups)
+    {
+        const auto residue {detail::trial_residue(n, group)};
+        for (auto i {group.first}; i < group.last; ++i)
+        {
+            const auto& p {detail::trial_primes[i]};
+            if (!detail::divides(p, residue))
+            {
+                continue;
+            }
+
+            const uint128_t prime {p.prime};
+            int multiplicity {};
+            do
+            {
+                n = divexact(n, prime);
+                ++multiplicity;
+            } while (is_divisible(n, prime));
+
+            result.factors[result.size++] = {prime, multiplicity};
+        }
+    }
+
+    if (n == 1U)
+    {
+        return result;
+    }
+
+    // Split the cofactor, keeping the composite parts on a stack
+    uint128_t primes[detail::max_large_prime_factors] {};
+    std::size_t prime_count {};
+
+    uint128_t composites[detail::max_large_prime_factors] {};
+    std::size_t composite_count {};
+    composites[composite_count++] = n;
+
+    while (composite_count > 0U)
+    {
+        const auto m {composites[--composite_count]};
+
+        if (m < detail::trial_bound || is_prime(m))
+        {
+            primes[prime_count++] = m;
+            continue;
+        }
+
+        const auto factor {detail::find_factor(m)};
+        composites[composite_count++] = factor;
+        composites[composite_count++] = divexact(m, factor);
+    }
+
+    // Insertion sort, since there are only a few large factors
+    for (std::size_t i {1}; i < prime_count; ++i)
+    {
+        const auto value {primes[i]};
+        auto j {i};
+        for (; j > 0U && primes[j - 1U] > value; --j)
+        {
+            primes[j] = primes[j - 1U];
+        }
+
+        primes[j] = value;
+    }
+
+    for (std::size_t i {}; i < prime_count; ++i)
+    {
+        if (i > 0U && primes[i] == primes[i - 1U])
+        {
+            ++result.factors[result.size - 1U].multiplicity;
+        }
+        else
+        {
+            result.factors[result.size++] = {primes[i], 1};
+        }
+    }
+
+    return result;
+}
+
+} // namespace int128
+} // namespace boost
+
+#endif // BOOST_INT128_PRIME_HPP
@@ -13,6 +13,8 @@ module;
 #include <cassert>
 #include <cerrno>
 #include <cstddef>
+#include <cmath>
+#include <system_error>
 
 #if __has_include(<__msvc_int128.hpp>) && _MSVC_LANG >= 202002L
 
@@ -13,6 +13,7 @@
 
 #include <iostream>
 #include <boost/int128/int128.hpp>
+#include <boost/int128/numeric.hpp>
 
 #ifdef BOOST_INT128_BENCHMARK_I128
 
@@ -300,6 +301,70 @@ BOOST_INT128_NO_INLINE void test_two_element_operation(const std::vector<T>& dat
     std::cerr << operation << "<" << std::left << std::setw(11) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
 }
 
+template <typename T, typename Func>
+BOOST_INT128_NO_INLINE void test_accumulation(const std::vector<T>& lhs, const std::vector<T>& rhs, Func op, const char* operation, const char* type)
+{
+    const auto t1 = std::chrono::steady_clock::now();
+    boost::int128::int128_t s {}; // discard variable
+
+    // The vectors are small enough to stay in cache, so this measures the multiplication throughput
+    // rather than the memory bandwidth
+    for (std::size_t k {}; k < K * (N / lhs.size()); ++k)
+    {
+        s += op(lhs.data(), rhs.data(), lhs.size());
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << operation << "<" << std::left << std::setw(11) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << static_cast<std::int64_t>(s) << ")\n";
+}
+
+void test_dot_product()
+{
+    using boost::int128::int128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Dot Product\n";
+    std::cerr << "---------------------------\n\n";
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::int64_t> dist((std::numeric_limits<std::int64_t>::min)(), (std::numeric_limits<std::int64_t>::max)());
+
+    constexpr std::size_t size {4096U};
+
+    std::vector<std::int64_t> lhs(size);
+    std::vector<std::int64_t> rhs(size);
+    for (std::size_t i {}; i < size; ++i)
+    {
+        lhs[i] = dist(gen);
+        rhs[i] = dist(gen);
+    }
+
+    test_accumulation(lhs, rhs, [](const std::int64_t* a, const std::int64_t* b, const std::size_t n) {
+        int128_t acc {};
+        for (std::size_t i {}; i < n; ++i)
+        {
+            acc += int128_t{a[i]} * int128_t{b[i]};
+        }
+        return acc;
+    }, "dot", "operator*");
+
+    test_accumulation(lhs, rhs, [](const std::int64_t* a, const std::int64_t* b, const std::size_t n) {
+        int128_t acc {};
+        for (std::size_t i {}; i < n; ++i)
+        {
+            acc = boost::int128::muladd(a[i], b[i], acc);
+        }
+        return acc;
+    }, "dot", "muladd");
+
+    test_accumulation(lhs, rhs, [](const std::int64_t* a, const std::int64_t* b, const std::size_t n) {
+        return boost::int128::dot_product(a, b, n);
+    }, "dot", "dot_product");
+
+    std::cerr << std::endl;
+}
+
 int main()
 {
     // Two word operations
@@ -661,6 +726,8 @@ int main()
         std::cerr << std::endl;
     }
 
+    test_dot_product();
+
     return 1;
 }
 
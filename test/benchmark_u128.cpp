@@ -23,16 +23,27 @@
 
 #include <boost/int128/int128.hpp>
 #include <boost/int128/numeric.hpp>
+#include <boost/int128/divider.hpp>
+#include <boost/int128/prime.hpp>
+#include <boost/int128/iostream.hpp>
+#include <boost/int128/charconv.hpp>
+
+// The benchmark does not link against {fmt}
+#define FMT_HEADER_ONLY
+#include <boost/int128/format.hpp>
+
 #include <chrono>
 #include <random>
 #include <vector>
 #include <type_traits>
 #include <iomanip>
 #include <string>
+#include <sstream>
 #include <cmath>
 #include <cstring>
 #include <functional>
 #include <numeric>
+#include <iterator>
 
 #if defined(__cpp_lib_gcd_lcm) && __cpp_lib_gcd_lcm >= 201606L && !defined(__STRICT_ANSI__) && !defined(BOOST_INT128_HAS_MSVC_INTERNAL_I128)
 #  define BOOST_INT128_BENCHMARK_BUILTIN_GCD
@@ -79,6 +90,8 @@ using namespace std::chrono_literals;
 
 #include <boost/multiprecision/cpp_int.hpp>
 #include <boost/random/uniform_int_distribution.hpp>
+#include <boost/integer/extended_euclidean.hpp>
+#include <boost/multiprecision/miller_rabin.hpp>
 using mp_u128 = boost::multiprecision::uint128_t;
 
 // 0 = 2 words
@@ -345,6 +358,1002 @@ BOOST_INT128_NO_INLINE void test_gcd(const std::vector<T>& data_vec, const char*
     std::cerr << "gcd" << "<" << std::left << std::setw(11) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
 }
 
+// Division kernels used by the portable path (i.e. BOOST_INT128_NO_BUILTIN_INT128)
+// Knuth's algorithm D on 32-bit words vs the Moller-Granlund reciprocal kernel on 64-bit limbs
+
+BOOST_INT128_NO_INLINE boost::int128::uint128_t knuth_words_div(const boost::int128::uint128_t lhs, const boost::int128::uint128_t rhs)
+{
+    using namespace boost::int128::detail;
+
+    std::uint32_t u[4] {};
+    std::uint32_t v[4] {};
+    std::uint32_t q[4] {};
+
+    const auto m {impl::to_words(lhs, u)};
+    const auto n {impl::to_words(rhs, v)};
+
+    if (m < n)
+    {
+        return 0U;
+    }
+
+    impl::knuth_divide<false>(u, m, v, n, q);
+
+    return impl::from_words<boost::int128::uint128_t>(q);
+}
+
+BOOST_INT128_NO_INLINE boost::int128::uint128_t mg_one_limb_div(const boost::int128::uint128_t lhs, const std::uint64_t rhs)
+{
+    std::uint64_t remainder {};
+    return boost::int128::detail::impl::mg_div_one_limb(lhs, rhs, remainder);
+}
+
+void test_division_kernels()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Portable Division Kernels\n";
+    std::cerr << "---------------------------\n\n";
+
+    const auto library_vector = generate_random_vector<0, boost::int128::uint128_t>();
+
+    // Divisors with two 64-bit limbs
+    const auto two_limbs = [](const uint128_t& lhs, uint128_t rhs) { rhs.high |= 1U; return lhs / rhs; };
+    test_two_element_operation(library_vector, [](const uint128_t& lhs, uint128_t rhs) { rhs.high |= 1U; return knuth_words_div(lhs, rhs); }, "div2", "Knuth");
+    test_two_element_operation(library_vector, two_limbs, "div2", "Library");
+
+    std::cerr << std::endl;
+
+    // Divisors with one 64-bit limb that does not fit into 32-bits
+    const auto one_limb = [](const uint128_t& lhs, const uint128_t& rhs) { return lhs / (rhs.low | (UINT64_C(1) << 63U)); };
+    test_two_element_operation(library_vector, [](const uint128_t& lhs, const uint128_t& rhs) { return knuth_words_div(lhs, uint128_t{rhs.low | (UINT64_C(1) << 63U)}); }, "div1", "Knuth");
+    test_two_element_operation(library_vector, [](const uint128_t& lhs, const uint128_t& rhs) { return mg_one_limb_div(lhs, rhs.low | (UINT64_C(1) << 63U)); }, "div1", "MG 2by1");
+    test_two_element_operation(library_vector, one_limb, "div1", "Library");
+
+    std::cerr << std::endl;
+}
+
+void test_wide_multiplication()
+{
+    using boost::int128::uint128_t;
+    using mp_u256 = boost::multiprecision::uint256_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Wide Multiplication\n";
+    std::cerr << "---------------------------\n\n";
+
+    const auto library_vector = generate_random_vector<0, uint128_t>();
+    const auto mp_vector = generate_random_vector<0, mp_u128>();
+
+    test_two_element_operation(library_vector, [](const uint128_t& lhs, const uint128_t& rhs) {
+        const auto product {boost::int128::mul_wide(lhs, rhs)};
+        return product.hi ^ product.lo;
+    }, "mul_wide", "Library");
+
+    test_two_element_operation(mp_vector, [](const mp_u128& lhs, const mp_u128& rhs) {
+        const auto product {static_cast<mp_u256>(lhs) * rhs};
+        return static_cast<mp_u128>(product >> 128U) ^ static_cast<mp_u128>(product);
+    }, "mul_wide", "multiprecision");
+
+    std::cerr << std::endl;
+
+    test_two_element_operation(library_vector, [](const uint128_t& lhs, const uint128_t& rhs) {
+        return boost::int128::mulhi(lhs, rhs);
+    }, "mulhi", "Library");
+
+    test_two_element_operation(mp_vector, [](const mp_u128& lhs, const mp_u128& rhs) {
+        return static_cast<mp_u128>((static_cast<mp_u256>(lhs) * rhs) >> 128U);
+    }, "mulhi", "multiprecision");
+
+    std::cerr << std::endl;
+}
+
+template <typename Func>
+BOOST_INT128_NO_INLINE void test_batch_operation(Func op, const char* operation, const char* type)
+{
+    const auto t1 = std::chrono::steady_clock::now();
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        op();
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << operation << "<" << std::left << std::setw(11) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us\n";
+}
+
+void test_batched_division()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Batched Division\n";
+    std::cerr << "---------------------------\n\n";
+
+    const auto dividends = generate_random_vector<0, uint128_t>();
+    const auto divisors = generate_random_vector<4, uint128_t>(N, 24U);
+    std::vector<uint128_t> out(dividends.size());
+    std::size_t s {};
+
+    const uint128_t divisors_to_test[] {uint128_t{UINT64_C(1000000007)}, uint128_t{UINT64_C(0xFFFFFFFFFFFFFFC5)}, uint128_t{UINT64_C(0x1234), UINT64_C(0x5678)}};
+    const char* divisor_names[] {"div32", "div64", "div128"};
+
+    for (std::size_t j {}; j < 3U; ++j)
+    {
+        const auto divisor {divisors_to_test[j]};
+
+        test_batch_operation([&] {
+            for (std::size_t i {}; i < dividends.size(); ++i)
+            {
+                out[i] = dividends[i] / divisor;
+            }
+            s += static_cast<std::size_t>(out.back());
+        }, divisor_names[j], "Scalar");
+
+        test_batch_operation([&] {
+            boost::int128::divide_n(dividends.data(), dividends.size(), divisor, out.data());
+            s += static_cast<std::size_t>(out.back());
+        }, divisor_names[j], "divide_n");
+
+        std::cerr << std::endl;
+    }
+
+    test_batch_operation([&] {
+        for (std::size_t i {}; i < dividends.size(); ++i)
+        {
+            out[i] = dividends[i] / divisors[i];
+        }
+        s += static_cast<std::size_t>(out.back());
+    }, "elem", "Scalar");
+
+    test_batch_operation([&] {
+        boost::int128::divide_n(dividends.data(), divisors.data(), dividends.size(), out.data());
+        s += static_cast<std::size_t>(out.back());
+    }, "elem", "divide_n");
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_modular_multiplication()
+{
+    using boost::int128::uint128_t;
+    using mp_u256 = boost::multiprecision::uint256_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Modular Multiplication\n";
+    std::cerr << "---------------------------\n\n";
+
+    const auto values = generate_random_vector<0, uint128_t>();
+    std::size_t s {};
+
+    const uint128_t moduli_to_test[] {uint128_t{UINT64_C(0xFFFFFFFFFFFFFFC5)}, (std::numeric_limits<uint128_t>::max)() - 158U};
+    const char* modulus_names[] {"mod64 ", "mod128"};
+
+    for (std::size_t j {}; j < 2U; ++j)
+    {
+        const auto m {moduli_to_test[j]};
+        const auto to_mp = [](const uint128_t x) { return (static_cast<mp_u128>(x.high) << 64U) | x.low; };
+        const mp_u128 mp_m {to_mp(m)};
+
+        std::vector<uint128_t> residues(values.size());
+        std::vector<mp_u128> mp_residues(values.size());
+        for (std::size_t i {}; i < values.size(); ++i)
+        {
+            residues[i] = values[i] % m;
+            mp_residues[i] = to_mp(residues[i]);
+        }
+
+        // A dependent chain of products, as in modular exponentiation
+        test_batch_operation([&] {
+            uint128_t acc {1U};
+            for (const auto& v : residues)
+            {
+                const auto product {boost::int128::mul_wide(acc, v)};
+                uint128_t remainder {};
+                static_cast<void>(boost::int128::detail::knuth_div_wide(product.hi, product.lo, m, remainder));
+                acc = remainder;
+            }
+            s += static_cast<std::size_t>(acc);
+        }, modulus_names[j], "Division");
+
+        test_batch_operation([&] {
+            mp_u128 acc {1U};
+            for (const auto& v : mp_residues)
+            {
+                acc = static_cast<mp_u128>(static_cast<mp_u256>(acc) * v % mp_m);
+            }
+            s += static_cast<std::size_t>(acc);
+        }, modulus_names[j], "mp::u256");
+
+        test_batch_operation([&] {
+            const boost::int128::montgomery_context<uint128_t> ctx {m};
+            auto acc {ctx.one()};
+            for (const auto& v : residues)
+            {
+                // Random residues are equally valid Montgomery representatives
+                acc = ctx.mul(acc, v);
+            }
+            s += static_cast<std::size_t>(ctx.from_mont(acc));
+        }, modulus_names[j], "Montgomery");
+
+        test_batch_operation([&] {
+            const boost::int128::barrett_reducer<uint128_t> reducer {m};
+            uint128_t acc {1U};
+            for (const auto& v : residues)
+            {
+                acc = reducer.mulmod(acc, v);
+            }
+            s += static_cast<std::size_t>(acc);
+        }, modulus_names[j], "Barrett");
+
+        std::cerr << std::endl;
+    }
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_modular_exponentiation()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Modular Exponentiation\n";
+    std::cerr << "---------------------------\n\n";
+
+    // Each exponentiation is roughly 200 modular multiplications, so fewer values suffice
+    const auto values = generate_random_vector<0, uint128_t>(N / 200U);
+    const auto exponents = generate_random_vector<0, uint128_t>(N / 200U, 43U);
+    std::vector<uint128_t> out(values.size());
+    std::size_t s {};
+
+    const uint128_t moduli_to_test[] {uint128_t{UINT64_C(0xFFFFFFFFFFFFFFC5)}, (std::numeric_limits<uint128_t>::max)() - 158U, (std::numeric_limits<uint128_t>::max)() - 159U};
+    const char* modulus_names[] {"mod64 ", "odd128", "even128"};
+
+    for (std::size_t j {}; j < 3U; ++j)
+    {
+        const auto m {moduli_to_test[j]};
+        const auto to_mp = [](const uint128_t x) { return (static_cast<mp_u128>(x.high) << 64U) | x.low; };
+        const mp_u128 mp_m {to_mp(m)};
+
+        std::vector<mp_u128> mp_values(values.size());
+        std::vector<mp_u128> mp_exponents(values.size());
+        for (std::size_t i {}; i < values.size(); ++i)
+        {
+            mp_values[i] = to_mp(values[i]);
+            mp_exponents[i] = to_mp(exponents[i]);
+        }
+
+        test_batch_operation([&] {
+            for (std::size_t i {}; i < values.size(); ++i)
+            {
+                s += static_cast<std::size_t>(boost::multiprecision::powm(mp_values[i], mp_exponents[i], mp_m));
+            }
+        }, modulus_names[j], "mp::powm");
+
+        test_batch_operation([&] {
+            for (std::size_t i {}; i < values.size(); ++i)
+            {
+                out[i] = boost::int128::powm(values[i], exponents[i], m);
+            }
+            s += static_cast<std::size_t>(out.back());
+        }, modulus_names[j], "powm");
+
+        test_batch_operation([&] {
+            boost::int128::powm_n(values.data(), exponents.data(), values.size(), m, out.data());
+            s += static_cast<std::size_t>(out.back());
+        }, modulus_names[j], "powm_n");
+
+        test_batch_operation([&] {
+            for (std::size_t i {}; i < values.size(); ++i)
+            {
+                out[i] = boost::int128::powm(values[i], exponents[0], m);
+            }
+            s += static_cast<std::size_t>(out.back());
+        }, modulus_names[j], "powm/exp");
+
+        test_batch_operation([&] {
+            boost::int128::powm_n(values.data(), values.size(), exponents[0], m, out.data());
+            s += static_cast<std::size_t>(out.back());
+        }, modulus_names[j], "powm_n/exp");
+
+        std::cerr << std::endl;
+    }
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_gcd_reduce()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "GCD Reduction\n";
+    std::cerr << "---------------------------\n\n";
+
+    // A shared 40-bit factor keeps the running gcd away from one
+    auto values = generate_random_vector<0, uint128_t>(N / 20U);
+    const uint128_t common_factor {UINT64_C(0xB2D05E00FF)};
+    for (auto& value : values)
+    {
+        value = (value >> 48U) * common_factor;
+    }
+
+    std::size_t s {};
+
+    test_batch_operation([&] {
+        uint128_t g {0};
+        for (const auto& value : values)
+        {
+            g = boost::int128::gcd(g, value);
+        }
+        s += static_cast<std::size_t>(g);
+    }, "gcd_reduce", "Sequential");
+
+    test_batch_operation([&] {
+        s += static_cast<std::size_t>(boost::int128::gcd_reduce(values.begin(), values.end()));
+    }, "gcd_reduce", "Library");
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_extended_gcd()
+{
+    using boost::int128::uint128_t;
+
+    // Bezout coefficients of two 128-bit values need a signed type of at least 129 bits
+    using mp_i256 = boost::multiprecision::int256_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Extended GCD\n";
+    std::cerr << "---------------------------\n\n";
+
+    const auto lhs = generate_random_vector<0, uint128_t>(N / 200U);
+    const auto rhs = generate_random_vector<0, uint128_t>(N / 200U, 43U);
+    std::size_t s {};
+
+    std::vector<mp_i256> mp_lhs(lhs.size());
+    std::vector<mp_i256> mp_rhs(rhs.size());
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        mp_lhs[i] = (static_cast<mp_i256>(lhs[i].high) << 64U) | lhs[i].low;
+        mp_rhs[i] = (static_cast<mp_i256>(rhs[i].high) << 64U) | rhs[i].low;
+    }
+
+    test_batch_operation([&] {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            s += static_cast<std::size_t>(boost::integer::extended_euclidean(mp_lhs[i], mp_rhs[i]).x < 0);
+        }
+    }, "xgcd", "mp::i256");
+
+    test_batch_operation([&] {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            s += static_cast<std::size_t>(boost::int128::extended_gcd(lhs[i], rhs[i]).x < 0);
+        }
+    }, "xgcd", "Library");
+
+    test_batch_operation([&] {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            s += static_cast<std::size_t>(boost::int128::mod_inverse(lhs[i], rhs[i]).value);
+        }
+    }, "inv ", "Library");
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_primality()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Primality and Factorization\n";
+    std::cerr << "---------------------------\n\n";
+
+    const auto to_mp = [](const uint128_t x) { return (static_cast<mp_u128>(x.high) << 64U) | x.low; };
+    const auto values = generate_random_vector<0, uint128_t>(N / 200U);
+
+    std::size_t s {};
+
+    for (const int bits : {64, 96, 127})
+    {
+        const auto name {bits == 64 ? "is_prime64 " : bits == 96 ? "is_prime96 " : "is_prime127"};
+
+        // Odd values of the requested width, since even ones are rejected immediately
+        std::vector<uint128_t> odd_values(values.size());
+        std::vector<mp_u128> mp_values(values.size());
+        for (std::size_t i {}; i < values.size(); ++i)
+        {
+            odd_values[i] = (values[i] >> (128 - bits)) | 1U;
+            mp_values[i] = to_mp(odd_values[i]);
+        }
+
+        // 25 rounds is the number recommended by the Boost.Multiprecision documentation
+        test_batch_operation([&] {
+            for (const auto& value : mp_values)
+            {
+                s += static_cast<std::size_t>(boost::multiprecision::miller_rabin_test(value, 25U));
+            }
+        }, name, "mp::MR");
+
+        test_batch_operation([&] {
+            for (const auto& value : odd_values)
+            {
+                s += static_cast<std::size_t>(boost::int128::is_prime(value));
+            }
+        }, name, "Library");
+    }
+
+    std::cerr << std::endl;
+
+    // Pollard's rho takes time proportional to the square root of the second largest prime factor.
+    // Random 127-bit values regularly have two 60-bit prime factors that take tens of seconds each,
+    // so the widest inputs are products of three random 42-bit values instead.
+    std::mt19937_64 gen {42U};
+    for (const int bits : {64, 96, 127})
+    {
+        const auto name {bits == 64 ? "factorize64 " : bits == 96 ? "factorize96 " : "factorize127"};
+
+        std::vector<uint128_t> composite_values(N / 200000U);
+        for (auto& value : composite_values)
+        {
+            value = bits == 127 ? uint128_t{gen() >> 21U} * (gen() >> 22U) * (gen() >> 22U) : uint128_t{gen(), gen()} >> (128 - bits);
+        }
+
+        test_batch_operation([&] {
+            for (const auto& value : composite_values)
+            {
+                s += boost::int128::factorize(value).size;
+            }
+        }, name, "Library");
+    }
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_roots()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Integer Roots\n";
+    std::cerr << "---------------------------\n\n";
+
+    const auto to_mp = [](const uint128_t x) { return (static_cast<mp_u128>(x.high) << 64U) | x.low; };
+    const auto values = generate_random_vector<0, uint128_t>(N / 20U);
+
+    std::vector<mp_u128> mp_values(values.size());
+    std::vector<uint128_t> squares(values.size());
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        mp_values[i] = to_mp(values[i]);
+        squares[i] = uint128_t{values[i].high} * values[i].high;
+    }
+
+    std::size_t s {};
+
+    test_batch_operation([&] {
+        for (const auto& value : mp_values)
+        {
+            s += static_cast<std::size_t>(boost::multiprecision::sqrt(value));
+        }
+    }, "isqrt     ", "mp::sqrt");
+
+    // The usual shortcut through long double, which is not exact for wide values
+    test_batch_operation([&] {
+        for (const auto& value : values)
+        {
+            s += static_cast<std::size_t>(std::sqrt(static_cast<long double>(value)));
+        }
+    }, "isqrt     ", "long double");
+
+    test_batch_operation([&] {
+        for (const auto& value : values)
+        {
+            s += static_cast<std::size_t>(boost::int128::isqrt(value));
+        }
+    }, "isqrt     ", "Library");
+
+    test_batch_operation([&] {
+        for (const auto& value : values)
+        {
+            s += static_cast<std::size_t>(boost::int128::icbrt(value));
+        }
+    }, "icbrt     ", "Library");
+
+    test_batch_operation([&] {
+        for (const auto& value : values)
+        {
+            s += static_cast<std::size_t>(boost::int128::iroot(value, 5));
+        }
+    }, "iroot5    ", "Library");
+
+    std::cerr << std::endl;
+
+    // Random values against exact squares, which are never rejected by the residue filters
+    test_batch_operation([&] {
+        for (const auto& value : values)
+        {
+            const auto root {boost::int128::isqrt(value)};
+            s += static_cast<std::size_t>(root * root == value);
+        }
+    }, "square    ", "isqrt");
+
+    test_batch_operation([&] {
+        for (const auto& value : values)
+        {
+            s += static_cast<std::size_t>(boost::int128::is_perfect_square(value));
+        }
+    }, "square    ", "Library");
+
+    test_batch_operation([&] {
+        for (const auto& value : squares)
+        {
+            s += static_cast<std::size_t>(boost::int128::is_perfect_square(value));
+        }
+    }, "square_hit", "Library");
+
+    test_batch_operation([&] {
+        for (const auto& value : values)
+        {
+            s += static_cast<std::size_t>(boost::int128::is_perfect_power(value));
+        }
+    }, "power     ", "Library");
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_digit_count()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Decimal Digit Count\n";
+    std::cerr << "---------------------------\n\n";
+
+    // Widths spread evenly over 1 to 128 bits
+    auto values = generate_random_vector<0, uint128_t>(N);
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        values[i] >>= static_cast<int>(i % 128U);
+    }
+
+    std::size_t s {};
+
+    test_batch_operation([&] {
+        for (auto value : values)
+        {
+            int digits {1};
+            while (value >= 10U)
+            {
+                value /= 10U;
+                ++digits;
+            }
+
+            s += static_cast<std::size_t>(digits);
+        }
+    }, "num_digits", "Division");
+
+    test_batch_operation([&] {
+        for (const auto& value : values)
+        {
+            s += static_cast<std::size_t>(boost::int128::num_digits(value));
+        }
+    }, "num_digits", "Library");
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_integer_power()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Integer Exponentiation\n";
+    std::cerr << "---------------------------\n\n";
+
+    std::mt19937_64 gen {42U};
+    std::vector<uint128_t> bases(N);
+    std::vector<unsigned> exps(N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        bases[i] = uint128_t{gen() >> (40U + gen() % 24U)};
+        exps[i] = static_cast<unsigned>(gen() % 64U);
+    }
+
+    std::size_t s {};
+
+    test_batch_operation([&] {
+        for (std::size_t i {}; i < N; ++i)
+        {
+            uint128_t power {1};
+            for (unsigned k {}; k < exps[i]; ++k)
+            {
+                power *= bases[i];
+            }
+
+            s += static_cast<std::size_t>(power);
+        }
+    }, "pow       ", "Loop");
+
+    test_batch_operation([&] {
+        for (std::size_t i {}; i < N; ++i)
+        {
+            s += static_cast<std::size_t>(boost::int128::ipow(bases[i], exps[i]));
+        }
+    }, "pow       ", "ipow");
+
+    test_batch_operation([&] {
+        for (std::size_t i {}; i < N; ++i)
+        {
+            s += static_cast<std::size_t>(boost::int128::pow_sat(bases[i], exps[i]));
+        }
+    }, "pow       ", "pow_sat");
+
+    test_batch_operation([&] {
+        for (std::size_t i {}; i < N; ++i)
+        {
+            uint128_t power {1};
+            for (unsigned k {}; k < exps[i] % 39U; ++k)
+            {
+                power *= 10U;
+            }
+
+            s += static_cast<std::size_t>(power);
+        }
+    }, "pow10     ", "Loop");
+
+    test_batch_operation([&] {
+        for (std::size_t i {}; i < N; ++i)
+        {
+            s += static_cast<std::size_t>(boost::int128::pow10_table<uint128_t>[exps[i] % 39U]);
+        }
+    }, "pow10     ", "Table");
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_to_chars()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Decimal Formatting\n";
+    std::cerr << "---------------------------\n\n";
+
+    // Widths spread evenly over 1 to 128 bits
+    auto values = generate_random_vector<0, uint128_t>(N);
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        values[i] >>= static_cast<int>(i % 128U);
+    }
+
+    std::vector<char> output(values.size() * 40U);
+    std::size_t s {};
+
+    test_batch_operation([&] {
+        auto first {output.data()};
+        for (auto value : values)
+        {
+            char digits[40] {};
+            auto p {digits + sizeof(digits)};
+            do
+            {
+                *--p = static_cast<char>('0' + static_cast<int>(value % 10U));
+                value /= 10U;
+            } while (value != 0U);
+
+            const auto size {static_cast<std::size_t>(digits + sizeof(digits) - p)};
+            std::memcpy(first, p, size);
+            first += size;
+        }
+
+        s += static_cast<std::size_t>(first - output.data());
+    }, "to_chars  ", "Division");
+
+    test_batch_operation([&] {
+        auto first {output.data()};
+        const auto last {first + output.size()};
+        for (const auto& value : values)
+        {
+            first = boost::int128::to_chars(first, last, value).ptr;
+        }
+
+        s += static_cast<std::size_t>(first - output.data());
+    }, "to_chars  ", "Library");
+
+    test_batch_operation([&] {
+        std::ostringstream os;
+        for (const auto& value : values)
+        {
+            os << value;
+        }
+
+        s += os.str().size();
+    }, "to_chars  ", "ostream");
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_to_chars_bases()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Formatting in Other Bases\n";
+    std::cerr << "---------------------------\n\n";
+
+    // Widths spread evenly over 1 to 128 bits, in bases without a shift per digit
+    auto values = generate_random_vector<0, uint128_t>(N);
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        values[i] >>= static_cast<int>(i % 128U);
+    }
+
+    // 81 base 3 digits are the longest output
+    std::vector<char> output(values.size() * 81U);
+    std::size_t s {};
+
+    for (const auto base : {3U, 7U, 36U})
+    {
+        std::cerr << "Base " << base << ":\n";
+
+        test_batch_operation([&] {
+            auto first {output.data()};
+            for (auto value : values)
+            {
+                char digits[81] {};
+                auto p {digits + sizeof(digits)};
+                do
+                {
+                    *--p = boost::int128::detail::lower_case_digit_table[static_cast<std::size_t>(value % base)];
+                    value /= base;
+                } while (value != 0U);
+
+                const auto size {static_cast<std::size_t>(digits + sizeof(digits) - p)};
+                std::memcpy(first, p, size);
+                first += size;
+            }
+
+            s += static_cast<std::size_t>(first - output.data());
+        }, "to_chars  ", "Division");
+
+        test_batch_operation([&] {
+            auto first {output.data()};
+            const auto last {first + output.size()};
+            for (const auto& value : values)
+            {
+                first = boost::int128::to_chars(first, last, value, static_cast<int>(base)).ptr;
+            }
+
+            s += static_cast<std::size_t>(first - output.data());
+        }, "to_chars  ", "Library");
+    }
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_from_chars()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Decimal Parsing\n";
+    std::cerr << "---------------------------\n\n";
+
+    // Comma separated values of 1 to 128 bits
+    const auto values = generate_random_vector<0, uint128_t>(N);
+    std::string text;
+    std::vector<std::size_t> ends;
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        char buffer[64] {};
+        const auto r {boost::int128::to_chars(buffer, buffer + sizeof(buffer), values[i] >> static_cast<int>(i % 128U))};
+        text.append(buffer, r.ptr);
+        ends.push_back(text.size());
+        text.push_back(',');
+    }
+
+    std::size_t s {};
+
+    test_batch_operation([&] {
+        const char* first {text.data()};
+        for (const auto end : ends)
+        {
+            uint128_t value {};
+            boost::int128::detail::from_chars(first, text.data() + end, value);
+            first = text.data() + end + 1U;
+            s += static_cast<std::size_t>(value);
+        }
+    }, "from_chars", "Per digit");
+
+    test_batch_operation([&] {
+        const char* first {text.data()};
+        const char* last {text.data() + text.size()};
+        while (first < last)
+        {
+            uint128_t value {};
+            first = boost::int128::from_chars(first, last, value).ptr + 1;
+            s += static_cast<std::size_t>(value);
+        }
+    }, "from_chars", "Library");
+
+    std::vector<uint128_t> column(values.size());
+    test_batch_operation([&] {
+        const auto r {boost::int128::parse_column(text.data(), text.size(), ',', column.data())};
+        for (std::size_t i {}; i < r.count; ++i)
+        {
+            s += static_cast<std::size_t>(column[i]);
+        }
+    }, "from_chars", "Column");
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_format_n()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Batch Formatting\n";
+    std::cerr << "---------------------------\n\n";
+
+    // Values of 1 to 128 bits written as comma separated text
+    auto values = generate_random_vector<0, uint128_t>(N);
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        values[i] >>= static_cast<int>(i % 128U);
+    }
+
+    std::size_t s {};
+
+    test_batch_operation([&] {
+        std::ostringstream os;
+        for (std::size_t i {}; i < values.size(); ++i)
+        {
+            if (i != 0U)
+            {
+                os << ',';
+            }
+            os << values[i];
+        }
+        s += os.str().size();
+    }, "format_n  ", "ostream");
+
+    std::string text;
+    test_batch_operation([&] {
+        text.resize(boost::int128::format_n_size(values.data(), values.size()));
+        const auto end {boost::int128::format_n(values.data(), values.size(), &text[0], ',')};
+        s += static_cast<std::size_t>(end - text.data());
+    }, "format_n  ", "Separated");
+
+    std::vector<std::size_t> offsets(values.size() + 1U);
+    test_batch_operation([&] {
+        text.resize(boost::int128::format_n_size(values.data(), values.size()));
+        boost::int128::format_n(values.data(), values.size(), &text[0], offsets.data());
+        s += offsets.back();
+    }, "format_n  ", "Offsets");
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+void test_stream()
+{
+    using boost::int128::uint128_t;
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Stream Throughput\n";
+    std::cerr << "---------------------------\n\n";
+
+    // Whitespace separated values of 1 to 128 bits through one large stringstream,
+    // with the low words as builtin values for scale
+    auto values = generate_random_vector<0, uint128_t>(N);
+    std::vector<std::uint64_t> low_words(values.size());
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        values[i] >>= static_cast<int>(i % 128U);
+        low_words[i] = values[i].low;
+    }
+
+    std::size_t s {};
+
+    std::stringstream builtin_stream;
+    test_batch_operation([&] {
+        builtin_stream.str("");
+        builtin_stream.clear();
+        for (const auto value : low_words)
+        {
+            builtin_stream << value << ' ';
+        }
+        s += static_cast<std::size_t>(builtin_stream.tellp());
+    }, "operator<<", "uint64_t");
+
+    std::stringstream library_stream;
+    test_batch_operation([&] {
+        library_stream.str("");
+        library_stream.clear();
+        for (const auto& value : values)
+        {
+            library_stream << value << ' ';
+        }
+        s += static_cast<std::size_t>(library_stream.tellp());
+    }, "operator<<", "Library");
+
+    test_batch_operation([&] {
+        builtin_stream.clear();
+        builtin_stream.seekg(0);
+        std::uint64_t value {};
+        while (builtin_stream >> value)
+        {
+            s += static_cast<std::size_t>(value);
+        }
+    }, "operator>>", "uint64_t");
+
+    test_batch_operation([&] {
+        library_stream.clear();
+        library_stream.seekg(0);
+        uint128_t value {};
+        while (library_stream >> value)
+        {
+            s += static_cast<std::size_t>(value);
+        }
+    }, "operator>>", "Library");
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+#if defined(BOOST_INT128_HAS_FORMAT) || defined(BOOST_INT128_HAS_FMT_FORMAT)
+
+void test_format()
+{
+    using boost::int128::uint128_t;
+
+    #ifdef BOOST_INT128_HAS_FORMAT
+    namespace format_ns = std;
+    #else
+    namespace format_ns = fmt;
+    #endif
+
+    std::cerr << "\n---------------------------\n";
+    std::cerr << "Formatted Log Lines\n";
+    std::cerr << "---------------------------\n\n";
+
+    auto values = generate_random_vector<0, uint128_t>(N);
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        values[i] >>= static_cast<int>(i % 128U);
+    }
+
+    std::size_t s {};
+
+    // One line per value, as a logger would build it
+    test_batch_operation([&] {
+        for (const auto value : values)
+        {
+            std::ostringstream os;
+            os << "value=" << value << " hex=" << std::hex << value << '\n';
+            s += os.str().size();
+        }
+    }, "format    ", "ostream");
+
+    std::string line;
+    test_batch_operation([&] {
+        for (const auto value : values)
+        {
+            line.clear();
+            format_ns::format_to(std::back_inserter(line), "value={} hex={:x}\n", value, value);
+            s += line.size();
+        }
+    }, "format    ", "format_to");
+
+    std::cerr << "(s=" << s << ")\n" << std::endl;
+}
+
+#endif
+
 int main()
 {
     using namespace boost::int128::detail;
@@ -718,6 +1727,27 @@ int main()
 
     }
 
+    test_division_kernels();
+    test_batched_division();
+    test_wide_multiplication();
+    test_modular_multiplication();
+    test_modular_exponentiation();
+    test_gcd_reduce();
+    test_extended_gcd();
+    test_primality();
+    test_roots();
+    test_digit_count();
+    test_integer_power();
+    test_to_chars();
+    test_to_chars_bases();
+    test_from_chars();
+    test_format_n();
+    test_stream();
+
+    #if defined(BOOST_INT128_HAS_FORMAT) || defined(BOOST_INT128_HAS_FMT_FORMAT)
+    test_format();
+    #endif
+
     return 1;
 }
 
@@ -0,0 +1,33 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Random values and reference results shared by the tests of the wide arithmetic
+
+#ifndef BOOST_INT128_TEST_RANDOM_U128_HPP
+#define BOOST_INT128_TEST_RANDOM_U128_HPP
+
+#include <boost/int128.hpp>
+#include <random>
+
+static std::mt19937_64 rng(42);
+
+// Random value of the requested width, so that every word size of the kernels is exercised
+inline boost::int128::uint128_t random_u128(const int bits)
+{
+    const boost::int128::uint128_t value {rng(), rng()};
+    return bits >= 128 ? value : value & ((boost::int128::uint128_t{1} << bits) - 1U);
+}
+
+// a * b mod m through the full 256-bit product
+inline boost::int128::uint128_t reference_mulmod(const boost::int128::uint128_t a, const boost::int128::uint128_t b,
+                                                 const boost::int128::uint128_t m)
+{
+    const auto product {boost::int128::mul_wide(a, b)};
+
+    boost::int128::uint128_t remainder {};
+    static_cast<void>(boost::int128::detail::knuth_div_wide(product.hi % m, product.lo, m, remainder));
+    return remainder;
+}
+
+#endif // BOOST_INT128_TEST_RANDOM_U128_HPP
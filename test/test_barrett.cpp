@@ -0,0 +1,111 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "random_u128.hpp"
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+constexpr std::size_t N = 256;
+
+// (high * 2^128 + low) mod m by long division
+uint128_t reference_reduce(const uint128_t high, const uint128_t low, const uint128_t m)
+{
+    uint128_t remainder {};
+    static_cast<void>(detail::knuth_div_wide(high % m, low, m, remainder));
+    return remainder;
+}
+
+void test_modulus(const uint128_t m)
+{
+    const barrett_reducer<uint128_t> reducer {m};
+    BOOST_TEST_EQ(reducer.modulus(), m);
+
+    constexpr auto max_value {(std::numeric_limits<uint128_t>::max)()};
+    const uint128_t edge_values[] {uint128_t{0}, uint128_t{1}, m - 1U, m, m + 1U, max_value - 1U, max_value};
+
+    for (const auto high : edge_values)
+    {
+        for (const auto low : edge_values)
+        {
+            BOOST_TEST_EQ(reducer.reduce(high, low), reference_reduce(high, low, m));
+        }
+    }
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto high {random_u128(static_cast<int>(rng() % 128U) + 1)};
+        const auto low {random_u128(128)};
+        BOOST_TEST_EQ(reducer.reduce(high, low), reference_reduce(high, low, m));
+
+        const auto a {random_u128(128) % m};
+        const auto b {(i & 1U) ? random_u128(static_cast<int>(rng() % 128U) + 1) % m : m - 1U - (random_u128(8) % m)};
+
+        const auto product {mul_wide(a, b)};
+        BOOST_TEST_EQ(reducer.mulmod(a, b), reference_reduce(product.hi, product.lo, m));
+
+        const auto sum {reducer.addmod(a, b)};
+        BOOST_TEST_EQ(sum, b >= m - a ? b - (m - a) : a + b);
+
+        const auto difference {reducer.submod(a, b)};
+        BOOST_TEST_EQ(difference, a >= b ? a - b : m - (b - a));
+    }
+}
+
+void test_moduli()
+{
+    const uint128_t edge_moduli[] {
+        uint128_t{1}, uint128_t{2}, uint128_t{3}, uint128_t{10}, uint128_t{1000000007},
+        uint128_t{UINT64_MAX}, uint128_t{1, 0}, uint128_t{1, 1},
+        uint128_t{1} << 127, (uint128_t{1} << 127) - 1U, (uint128_t{1} << 127) + 1U,
+        (std::numeric_limits<uint128_t>::max)(), (std::numeric_limits<uint128_t>::max)() - 1U
+    };
+
+    for (const auto m : edge_moduli)
+    {
+        test_modulus(m);
+    }
+
+    for (const int bits : {16, 64, 100, 127, 128})
+    {
+        for (std::size_t i {}; i < 8U; ++i)
+        {
+            auto m {random_u128(bits)};
+            if (m == 0U)
+            {
+                m = 1U;
+            }
+
+            test_modulus(m);
+        }
+    }
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    constexpr barrett_reducer<uint128_t> reducer {uint128_t{1000000000}};
+    static_assert(reducer.mulmod(uint128_t{123456789}, uint128_t{987654321}) == 112635269U, "Wrong");
+    static_assert(reducer.reduce(uint128_t{1}, uint128_t{0}) == 768211456U, "Wrong");
+    static_assert(reducer.addmod(uint128_t{999999999}, uint128_t{2}) == 1U, "Wrong");
+    static_assert(reducer.submod(uint128_t{1}, uint128_t{2}) == 999999999U, "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_moduli();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
@@ -5,6 +5,9 @@
 #include <boost/int128/int128.hpp>
 #include <boost/int128/bit.hpp>
 #include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <cstdint>
 
 void test_has_single_bit()
 {
@@ -284,6 +287,94 @@ void test_bit_scan_reverse()
     }
 }
 
+void test_ilog2()
+{
+    BOOST_TEST_EQ(boost::int128::ilog2(0), -1);
+
+    boost::int128::uint128_t x {1};
+
+    for (int i {}; i < 128; ++i)
+    {
+        BOOST_TEST_EQ(boost::int128::ilog2(x), i);
+        BOOST_TEST_EQ(boost::int128::ilog2(x | (x >> 1U)), i);
+        x <<= 1;
+    }
+
+    static_assert(boost::int128::ilog2(boost::int128::uint128_t{1} << 100) == 100, "wrong");
+}
+
+// Counts digits by repeated division
+int reference_num_digits(boost::int128::uint128_t x, const unsigned base)
+{
+    int digits {1};
+    while (x >= base)
+    {
+        x /= base;
+        ++digits;
+    }
+
+    return digits;
+}
+
+void test_ilog10()
+{
+    BOOST_TEST_EQ(boost::int128::ilog10(0), -1);
+    BOOST_TEST_EQ(boost::int128::ilog10((std::numeric_limits<boost::int128::uint128_t>::max)()), 38);
+
+    // Every power of ten and its neighbours
+    boost::int128::uint128_t power {1};
+    for (int i {}; i < 39; ++i)
+    {
+        BOOST_TEST_EQ(boost::int128::ilog10(power), i);
+        BOOST_TEST_EQ(boost::int128::ilog10(power - 1U), i - 1);
+        BOOST_TEST_EQ(boost::int128::ilog10(power + 1U), i == 0 ? 0 : i);
+        power *= 10U;
+    }
+
+    // Both ends of every bit width
+    boost::int128::uint128_t x {1};
+    for (int i {}; i < 128; ++i)
+    {
+        BOOST_TEST_EQ(boost::int128::ilog10(x), reference_num_digits(x, 10U) - 1);
+        BOOST_TEST_EQ(boost::int128::ilog10(x + (x - 1U)), reference_num_digits(x + (x - 1U), 10U) - 1);
+        x <<= 1;
+    }
+
+    static_assert(boost::int128::ilog10(boost::int128::uint128_t{UINT64_C(10000000000000000000)}) == 19, "wrong");
+    static_assert(boost::int128::ilog10(boost::int128::uint128_t{UINT64_C(9999999999999999999)}) == 18, "wrong");
+}
+
+void test_num_digits()
+{
+    std::mt19937_64 rng {42};
+
+    for (int base {2}; base <= 36; ++base)
+    {
+        const auto unsigned_base {static_cast<unsigned>(base)};
+
+        BOOST_TEST_EQ(boost::int128::num_digits(0, base), 1);
+        BOOST_TEST_EQ(boost::int128::num_digits(1, base), 1);
+        BOOST_TEST_EQ(boost::int128::num_digits(unsigned_base - 1U, base), 1);
+        BOOST_TEST_EQ(boost::int128::num_digits(unsigned_base, base), 2);
+
+        const auto max {(std::numeric_limits<boost::int128::uint128_t>::max)()};
+        BOOST_TEST_EQ(boost::int128::num_digits(max, base), reference_num_digits(max, unsigned_base));
+
+        for (int i {}; i < 256; ++i)
+        {
+            const auto x {boost::int128::uint128_t{rng(), rng()} >> static_cast<int>(rng() % 128U)};
+            BOOST_TEST_EQ(boost::int128::num_digits(x, base), reference_num_digits(x, unsigned_base));
+        }
+    }
+
+    BOOST_TEST_EQ(boost::int128::num_digits((std::numeric_limits<boost::int128::uint128_t>::max)()), 39);
+    BOOST_TEST_EQ(boost::int128::num_digits((std::numeric_limits<boost::int128::uint128_t>::max)(), 2), 128);
+    BOOST_TEST_EQ(boost::int128::num_digits((std::numeric_limits<boost::int128::uint128_t>::max)(), 16), 32);
+
+    static_assert(boost::int128::num_digits(boost::int128::uint128_t{1} << 64, 3) == 41, "wrong");
+    static_assert(boost::int128::num_digits(boost::int128::uint128_t{1} << 64, 8) == 22, "wrong");
+}
+
 int main()
 {
     test_has_single_bit();
@@ -299,6 +390,9 @@ int main()
     test_rotr();
     test_popcount();
     test_byteswap();
+    test_ilog2();
+    test_ilog10();
+    test_num_digits();
 
     test_clz();
     test_bit_scan_reverse();
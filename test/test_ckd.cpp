@@ -0,0 +1,187 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng(42);
+
+constexpr std::size_t N = 1024;
+
+constexpr auto u_max {(std::numeric_limits<uint128_t>::max)()};
+constexpr auto i_max {(std::numeric_limits<int128_t>::max)()};
+constexpr auto i_min {(std::numeric_limits<int128_t>::min)()};
+
+// Random value of random width so that both small and overflowing cases are common
+uint128_t random_u128()
+{
+    const uint128_t value {rng(), rng()};
+    return value >> static_cast<int>(rng() % 128U);
+}
+
+int128_t random_i128()
+{
+    const auto value {static_cast<int128_t>(random_u128())};
+    return (rng() & 1U) ? -value : value;
+}
+
+void test_unsigned()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto x {random_u128()};
+        const auto y {random_u128()};
+
+        uint128_t res {};
+
+        BOOST_TEST_EQ(ckd_add(&res, x, y), y > u_max - x);
+        BOOST_TEST_EQ(res, x + y);
+
+        BOOST_TEST_EQ(ckd_sub(&res, x, y), y > x);
+        BOOST_TEST_EQ(res, x - y);
+
+        BOOST_TEST_EQ(ckd_mul(&res, x, y), mulhi(x, y) != 0U);
+        BOOST_TEST_EQ(res, x * y);
+    }
+
+    uint128_t res {};
+
+    BOOST_TEST(!ckd_add(&res, u_max, uint128_t{0}));
+    BOOST_TEST(ckd_add(&res, u_max, uint128_t{1}));
+    BOOST_TEST_EQ(res, 0U);
+    BOOST_TEST(!ckd_sub(&res, uint128_t{1}, uint128_t{1}));
+    BOOST_TEST(ckd_sub(&res, uint128_t{0}, uint128_t{1}));
+    BOOST_TEST_EQ(res, u_max);
+
+    // Each of the ways that the partial products can overflow
+    BOOST_TEST(!ckd_mul(&res, uint128_t{1} << 64, uint128_t{1} << 63));
+    BOOST_TEST_EQ(res, uint128_t{1} << 127);
+    BOOST_TEST(ckd_mul(&res, uint128_t{1} << 64, uint128_t{1} << 64));
+    BOOST_TEST(ckd_mul(&res, uint128_t{1} << 64, uint128_t{UINT64_MAX} << 1));
+    BOOST_TEST(ckd_mul(&res, uint128_t{UINT64_C(1) << 63, 0}, uint128_t{2}));
+    BOOST_TEST(ckd_mul(&res, uint128_t{UINT64_MAX, UINT64_MAX}, uint128_t{UINT64_MAX}));
+    BOOST_TEST(ckd_mul(&res, uint128_t{UINT64_C(0x8000000000000000), 1}, uint128_t{1, 0}));
+    BOOST_TEST(!ckd_mul(&res, u_max, uint128_t{1}));
+    BOOST_TEST(!ckd_mul(&res, u_max, uint128_t{0}));
+
+    // (2^64 + 1) * (2^64 - 1) == 2^128 - 1 only fits exactly
+    BOOST_TEST(!ckd_mul(&res, uint128_t{1, 1}, uint128_t{UINT64_MAX}));
+    BOOST_TEST_EQ(res, u_max);
+    BOOST_TEST(ckd_mul(&res, uint128_t{1, 2}, uint128_t{UINT64_MAX}));
+}
+
+void test_signed()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto x {random_i128()};
+        const auto y {random_i128()};
+
+        int128_t res {};
+
+        const auto add_overflow {(x > 0 && y > i_max - x) || (x < 0 && y < i_min - x)};
+        BOOST_TEST_EQ(ckd_add(&res, x, y), add_overflow);
+        BOOST_TEST_EQ(res, static_cast<int128_t>(static_cast<uint128_t>(x) + static_cast<uint128_t>(y)));
+
+        const auto sub_overflow {(y < 0 && x > i_max + y) || (y > 0 && x < i_min + y)};
+        BOOST_TEST_EQ(ckd_sub(&res, x, y), sub_overflow);
+        BOOST_TEST_EQ(res, static_cast<int128_t>(static_cast<uint128_t>(x) - static_cast<uint128_t>(y)));
+
+        // The product fits when the high half is the sign extension of the low half
+        const auto product {mul_wide(x, y)};
+        const auto mul_overflow {product.hi != (static_cast<int128_t>(product.lo) >> 127)};
+        BOOST_TEST_EQ(ckd_mul(&res, x, y), mul_overflow);
+        BOOST_TEST_EQ(res, static_cast<int128_t>(product.lo));
+    }
+
+    int128_t res {};
+
+    BOOST_TEST(ckd_add(&res, i_max, int128_t{1}));
+    BOOST_TEST_EQ(res, i_min);
+    BOOST_TEST(ckd_add(&res, i_min, int128_t{-1}));
+    BOOST_TEST(!ckd_add(&res, i_min, i_max));
+    BOOST_TEST_EQ(res, -1);
+
+    BOOST_TEST(ckd_sub(&res, i_min, int128_t{1}));
+    BOOST_TEST(ckd_sub(&res, int128_t{0}, i_min));
+    BOOST_TEST(!ckd_sub(&res, int128_t{-1}, i_min));
+    BOOST_TEST_EQ(res, i_max);
+
+    BOOST_TEST(ckd_mul(&res, i_min, int128_t{-1}));
+    BOOST_TEST_EQ(res, i_min);
+    BOOST_TEST(!ckd_mul(&res, i_min, int128_t{1}));
+    BOOST_TEST(!ckd_mul(&res, int128_t{1} << 126, int128_t{-2}));
+    BOOST_TEST_EQ(res, i_min);
+    BOOST_TEST(ckd_mul(&res, int128_t{1} << 126, int128_t{2}));
+    BOOST_TEST(!ckd_mul(&res, i_max, int128_t{-1}));
+    BOOST_TEST_EQ(res, -i_max);
+}
+
+void test_saturating()
+{
+    // Products where the sum of the bit widths exceeds the width of the type, but which still fit
+    BOOST_TEST_EQ(mul_sat(uint128_t{1} << 64, uint128_t{1} << 63), uint128_t{1} << 127);
+    BOOST_TEST_EQ(mul_sat(uint128_t{1, 1}, uint128_t{UINT64_MAX}), u_max);
+    BOOST_TEST_EQ(mul_sat(int128_t{1} << 63, int128_t{1} << 63), int128_t{1} << 126);
+    BOOST_TEST_EQ(mul_sat(int128_t{1} << 126, int128_t{-2}), i_min);
+    BOOST_TEST_EQ(mul_sat(i_min, int128_t{-1}), i_max);
+    BOOST_TEST_EQ(mul_sat(i_min, int128_t{2}), i_min);
+
+    BOOST_TEST_EQ(add_sat(i_min, int128_t{-1}), i_min);
+    BOOST_TEST_EQ(add_sat(i_max, i_max), i_max);
+    BOOST_TEST_EQ(sub_sat(int128_t{0}, i_min), i_max);
+    BOOST_TEST_EQ(sub_sat(int128_t{-2}, i_max), i_min);
+    BOOST_TEST_EQ(sub_sat(int128_t{-1}, i_min), i_max);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto x {random_i128()};
+        const auto y {random_i128()};
+
+        int128_t res {};
+        const auto saturated {(x < 0) != (y < 0) ? i_min : i_max};
+        BOOST_TEST_EQ(mul_sat(x, y), ckd_mul(&res, x, y) ? saturated : res);
+    }
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+constexpr bool constexpr_ckd()
+{
+    uint128_t u_res {};
+    int128_t i_res {};
+
+    return ckd_add(&u_res, u_max, uint128_t{1}) && u_res == 0U &&
+           !ckd_sub(&u_res, uint128_t{3}, uint128_t{2}) && u_res == 1U &&
+           ckd_mul(&u_res, uint128_t{1} << 64, uint128_t{1} << 64) &&
+           ckd_add(&i_res, i_max, int128_t{1}) && i_res == i_min &&
+           !ckd_sub(&i_res, int128_t{-1}, i_min) && i_res == i_max &&
+           !ckd_mul(&i_res, int128_t{-3}, int128_t{5}) && i_res == -15;
+}
+
+void test_constexpr()
+{
+    static_assert(constexpr_ckd(), "Wrong");
+    static_assert(mul_sat(uint128_t{1} << 64, uint128_t{1} << 63) == uint128_t{1} << 127, "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_unsigned();
+    test_signed();
+    test_saturating();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,193 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/cstdlib.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "random_u128.hpp"
+#include <type_traits>
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+constexpr std::size_t N = 1024;
+
+// Reference values computed on the magnitudes so that min is handled for every divisor
+int128_t reference_div(const int128_t n, const int128_t d)
+{
+    const auto abs_n {static_cast<uint128_t>(abs(n))};
+    const auto abs_d {static_cast<uint128_t>(abs(d))};
+    const auto q {abs_n / abs_d};
+
+    return static_cast<int128_t>((n < 0) != (d < 0) ? uint128_t{0} - q : q);
+}
+
+int128_t reference_mod(const int128_t n, const int128_t d)
+{
+    return n - reference_div(n, d) * d;
+}
+
+static_assert(std::is_same<decltype(div(uint128_t{}, uint128_t{})), div_result<uint128_t>>::value, "Wrong type");
+static_assert(std::is_same<decltype(div(uint128_t{}, std::uint64_t{})), div_result<uint128_t, std::uint64_t>>::value, "Wrong type");
+static_assert(std::is_same<decltype(div(uint128_t{}, std::uint32_t{})), div_result<uint128_t, std::uint32_t>>::value, "Wrong type");
+static_assert(std::is_same<decltype(div(uint128_t{}, std::uint16_t{})), div_result<uint128_t, std::uint32_t>>::value, "Wrong type");
+static_assert(std::is_same<decltype(div(int128_t{}, int128_t{})), div_result<int128_t>>::value, "Wrong type");
+static_assert(std::is_same<decltype(div(int128_t{}, std::int64_t{})), div_result<int128_t, std::int64_t>>::value, "Wrong type");
+static_assert(std::is_same<decltype(div(int128_t{}, std::int32_t{})), div_result<int128_t, std::int32_t>>::value, "Wrong type");
+
+void test_unsigned()
+{
+    for (const int dividend_bits : {32, 64, 96, 128})
+    {
+        for (const int divisor_bits : {16, 32, 48, 64, 96, 128})
+        {
+            for (std::size_t i {}; i < N / 16; ++i)
+            {
+                const auto x {random_u128(dividend_bits)};
+                const auto y {random_u128(divisor_bits)};
+
+                const auto result {div(x, y)};
+                BOOST_TEST_EQ(result.quot, x / y);
+                BOOST_TEST_EQ(result.rem, x % y);
+
+                if (divisor_bits <= 64)
+                {
+                    const auto y64 {static_cast<std::uint64_t>(y)};
+                    const auto narrow_result {div(x, y64)};
+                    BOOST_TEST_EQ(narrow_result.quot, x / y);
+                    BOOST_TEST_EQ(narrow_result.rem, x % y);
+                }
+
+                if (divisor_bits <= 32)
+                {
+                    const auto y32 {static_cast<std::uint32_t>(y)};
+                    const auto narrow_result {div(x, y32)};
+                    BOOST_TEST_EQ(narrow_result.quot, x / y);
+                    BOOST_TEST_EQ(narrow_result.rem, x % y);
+                }
+            }
+        }
+    }
+
+    // Division by zero matches the operators
+    const auto max_value {(std::numeric_limits<uint128_t>::max)()};
+
+    BOOST_TEST_EQ(div(max_value, uint128_t{0}).quot, 0U);
+    BOOST_TEST_EQ(div(max_value, uint128_t{0}).rem, 0U);
+    BOOST_TEST_EQ(div(max_value, std::uint64_t{0}).quot, 0U);
+    BOOST_TEST_EQ(div(max_value, std::uint64_t{0}).rem, 0U);
+    BOOST_TEST_EQ(div(max_value, std::uint32_t{0}).quot, 0U);
+    BOOST_TEST_EQ(div(max_value, std::uint32_t{0}).rem, 0U);
+
+    BOOST_TEST_EQ(div(max_value, UINT64_MAX).quot, (uint128_t{1, 1}));
+    BOOST_TEST_EQ(div(max_value, UINT64_MAX).rem, 0U);
+    BOOST_TEST_EQ(div(max_value, UINT32_MAX).rem, 0U);
+    BOOST_TEST_EQ(div(max_value, max_value).quot, 1U);
+    BOOST_TEST_EQ(div(max_value - 1U, max_value).rem, max_value - 1U);
+}
+
+void test_signed()
+{
+    for (const int dividend_bits : {32, 64, 96, 127})
+    {
+        for (const int divisor_bits : {16, 31, 48, 63, 96, 127})
+        {
+            for (std::size_t i {}; i < N / 16; ++i)
+            {
+                auto x {static_cast<int128_t>(random_u128(dividend_bits))};
+                auto y {static_cast<int128_t>(random_u128(divisor_bits))};
+
+                if (rng() & 1U)
+                {
+                    x = -x;
+                }
+                if (rng() & 1U)
+                {
+                    y = -y;
+                }
+                if (y == 0)
+                {
+                    y = 1;
+                }
+
+                const auto result {div(x, y)};
+                BOOST_TEST_EQ(result.quot, reference_div(x, y));
+                BOOST_TEST_EQ(result.rem, reference_mod(x, y));
+
+                if (divisor_bits <= 63)
+                {
+                    const auto narrow_result {div(x, static_cast<std::int64_t>(y))};
+                    BOOST_TEST_EQ(narrow_result.quot, reference_div(x, y));
+                    BOOST_TEST_EQ(narrow_result.rem, reference_mod(x, y));
+                }
+
+                if (divisor_bits <= 31)
+                {
+                    const auto narrow_result {div(x, static_cast<std::int32_t>(y))};
+                    BOOST_TEST_EQ(narrow_result.quot, reference_div(x, y));
+                    BOOST_TEST_EQ(narrow_result.rem, reference_mod(x, y));
+                }
+            }
+        }
+    }
+
+    // The narrow minimum values have magnitudes that only fit in the unsigned types
+    constexpr auto min_value {(std::numeric_limits<int128_t>::min)()};
+    constexpr auto max_value {(std::numeric_limits<int128_t>::max)()};
+
+    const int128_t edge_dividends[] {min_value, min_value + 1, max_value, int128_t{-1}, int128_t{0}, int128_t{INT64_MIN}};
+    for (const auto x : edge_dividends)
+    {
+        const auto result64 {div(x, INT64_MIN)};
+        BOOST_TEST_EQ(result64.quot, reference_div(x, int128_t{INT64_MIN}));
+        BOOST_TEST_EQ(result64.rem, reference_mod(x, int128_t{INT64_MIN}));
+
+        const auto result32 {div(x, INT32_MIN)};
+        BOOST_TEST_EQ(result32.quot, reference_div(x, int128_t{INT32_MIN}));
+        BOOST_TEST_EQ(result32.rem, reference_mod(x, int128_t{INT32_MIN}));
+
+        const auto result {div(x, min_value)};
+        BOOST_TEST_EQ(result.quot, reference_div(x, min_value));
+        BOOST_TEST_EQ(result.rem, reference_mod(x, min_value));
+
+        const auto by_seven {div(x, int128_t{-7})};
+        BOOST_TEST_EQ(by_seven.quot, reference_div(x, int128_t{-7}));
+        BOOST_TEST_EQ(by_seven.rem, reference_mod(x, int128_t{-7}));
+    }
+
+    BOOST_TEST_EQ(div(max_value, int128_t{0}).quot, 0);
+    BOOST_TEST_EQ(div(max_value, int128_t{0}).rem, 0);
+    BOOST_TEST_EQ(div(max_value, std::int64_t{0}).quot, 0);
+    BOOST_TEST_EQ(div(max_value, std::int32_t{0}).rem, 0);
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    static_assert(div(uint128_t{12345U}, uint128_t{10U}).quot == 1234U, "Wrong");
+    static_assert(div(uint128_t{12345U}, uint128_t{10U}).rem == 5U, "Wrong");
+    static_assert(div(uint128_t{1, 0}, UINT64_C(10)).rem == 6U, "Wrong");
+    static_assert(div(uint128_t{1, 0}, UINT32_C(7)).rem == 2U, "Wrong");
+    static_assert(div(int128_t{-100}, int128_t{7}).quot == -14, "Wrong");
+    static_assert(div(int128_t{-100}, int128_t{7}).rem == -2, "Wrong");
+    static_assert(div(int128_t{100}, INT64_C(-7)).rem == 2, "Wrong");
+    static_assert(div(int128_t{-100}, INT32_C(-7)).quot == 14, "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_unsigned();
+    test_signed();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,176 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "random_u128.hpp"
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+constexpr std::size_t N = 1024;
+
+void test_inverse()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto d {random_u128(128) | 1U};
+        BOOST_TEST_EQ(d * detail::inverse_mod_2_128(d), 1U);
+    }
+
+    BOOST_TEST_EQ(detail::inverse_mod_2_128(uint128_t{1}), 1U);
+    BOOST_TEST_EQ(detail::inverse_mod_2_128((std::numeric_limits<uint128_t>::max)()), (std::numeric_limits<uint128_t>::max)());
+}
+
+void test_unsigned()
+{
+    for (const int quotient_bits : {16, 64, 100, 127})
+    {
+        for (const int divisor_bits : {1, 8, 32, 64, 96, 128})
+        {
+            for (std::size_t i {}; i < N / 16; ++i)
+            {
+                auto d {random_u128(divisor_bits)};
+                if (d == 0U)
+                {
+                    d = 1U;
+                }
+
+                // Keep only as many bits of the quotient as the product allows
+                auto q {random_u128(quotient_bits)};
+                q >>= bit_width(d) - 1;
+
+                const auto x {q * d};
+
+                BOOST_TEST_EQ(divexact(x, d), q);
+                BOOST_TEST(is_divisible(x, d));
+
+                // Any value between two multiples is not divisible
+                if (d > 1U)
+                {
+                    const auto off {x + 1U + random_u128(128) % (d - 1U)};
+                    BOOST_TEST_EQ(is_divisible(off, d), off % d == 0U);
+                }
+            }
+        }
+    }
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto x {random_u128(static_cast<int>(rng() % 128U) + 1)};
+        const auto d {random_u128(static_cast<int>(rng() % 16U) + 1) + 1U};
+
+        BOOST_TEST_EQ(is_divisible(x, d), x % d == 0U);
+    }
+
+    constexpr auto max_value {(std::numeric_limits<uint128_t>::max)()};
+
+    BOOST_TEST_EQ(divexact(max_value, max_value), 1U);
+    BOOST_TEST_EQ(divexact(max_value, uint128_t{3}), max_value / 3U);
+    BOOST_TEST_EQ(divexact(uint128_t{1} << 127, uint128_t{1} << 64), uint128_t{1} << 63);
+    BOOST_TEST_EQ(divexact(uint128_t{0}, uint128_t{7}), 0U);
+    BOOST_TEST_EQ(divexact(uint128_t{7}, uint128_t{0}), 0U);
+
+    BOOST_TEST(is_divisible(max_value, uint128_t{5}));
+    BOOST_TEST(!is_divisible(max_value, uint128_t{7}));
+    BOOST_TEST(!is_divisible(max_value - 1U, max_value));
+    BOOST_TEST(is_divisible(uint128_t{0}, uint128_t{0}));
+    BOOST_TEST(!is_divisible(uint128_t{1}, uint128_t{0}));
+    BOOST_TEST(is_divisible(uint128_t{0}, uint128_t{3}));
+    BOOST_TEST(!is_divisible(uint128_t{1} << 64, (uint128_t{1} << 65)));
+    BOOST_TEST(is_divisible(uint128_t{3} << 100, uint128_t{3} << 99));
+}
+
+void test_signed()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        auto d {static_cast<int128_t>(random_u128(static_cast<int>(rng() % 64U) + 1))};
+        if (d == 0)
+        {
+            d = 1;
+        }
+        auto q {static_cast<int128_t>(random_u128(62))};
+
+        if (rng() & 1U)
+        {
+            d = -d;
+        }
+        if (rng() & 1U)
+        {
+            q = -q;
+        }
+
+        const auto x {q * d};
+
+        BOOST_TEST_EQ(divexact(x, d), q);
+        BOOST_TEST(is_divisible(x, d));
+        BOOST_TEST_EQ(is_divisible(x + 1, d), d == 1 || d == -1);
+    }
+
+    constexpr auto min_value {(std::numeric_limits<int128_t>::min)()};
+    constexpr auto max_value {(std::numeric_limits<int128_t>::max)()};
+
+    BOOST_TEST_EQ(divexact(min_value, min_value), 1);
+    BOOST_TEST_EQ(divexact(min_value, int128_t{2}), -(int128_t{1} << 126));
+    BOOST_TEST_EQ(divexact(min_value, int128_t{-2}), int128_t{1} << 126);
+    BOOST_TEST_EQ(divexact(max_value, int128_t{-1}), -max_value);
+    BOOST_TEST_EQ(divexact(-max_value, max_value), -1);
+
+    BOOST_TEST(is_divisible(min_value, min_value));
+    BOOST_TEST(is_divisible(min_value, int128_t{-4}));
+    BOOST_TEST(!is_divisible(min_value, int128_t{3}));
+    BOOST_TEST(is_divisible(int128_t{-21}, int128_t{7}));
+    BOOST_TEST(!is_divisible(int128_t{-22}, int128_t{-7}));
+}
+
+void test_lcm()
+{
+    // a / gcd(a, b) is now computed with divexact
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto g {random_u128(32) | 1U};
+        const auto a {random_u128(40) * g};
+        const auto b {random_u128(40) * g};
+
+        if (a == 0U || b == 0U)
+        {
+            continue;
+        }
+
+        const auto l {lcm(a, b)};
+        BOOST_TEST_EQ(l % a, 0U);
+        BOOST_TEST_EQ(l % b, 0U);
+        BOOST_TEST_EQ(l, a / gcd(a, b) * b);
+    }
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    static_assert(divexact(uint128_t{1000000007} * 12345U, uint128_t{1000000007}) == 12345U, "Wrong");
+    static_assert(divexact(int128_t{-120}, int128_t{8}) == -15, "Wrong");
+    static_assert(is_divisible(uint128_t{1, 0}, uint128_t{256}), "Wrong");
+    static_assert(!is_divisible(uint128_t{1, 0}, uint128_t{3}), "Wrong");
+    static_assert(is_divisible(int128_t{-81}, int128_t{-27}), "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_inverse();
+    test_unsigned();
+    test_signed();
+    test_lcm();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,138 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <vector>
+#include <cstdint>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng(42);
+
+// Covers both the scalar path for small batches and the unrolled loop with a tail
+static constexpr std::size_t sizes[] {0U, 1U, 3U, 15U, 16U, 17U, 1023U};
+
+uint128_t random_u128()
+{
+    const auto bits {static_cast<int>(rng() % 128U) + 1};
+    const uint128_t value {rng(), rng()};
+    return bits >= 128 ? value : value & ((uint128_t{1} << bits) - 1U);
+}
+
+template <typename T>
+T random_value();
+
+template <>
+uint128_t random_value<uint128_t>()
+{
+    return random_u128();
+}
+
+template <>
+int128_t random_value<int128_t>()
+{
+    // Keep away from min which can not be negated
+    const auto value {static_cast<int128_t>(random_u128() >> 1U)};
+    return (rng() & 1U) ? value : -value;
+}
+
+template <typename T>
+void test_single_divisor()
+{
+    for (const auto n : sizes)
+    {
+        std::vector<T> in(n);
+        for (auto& value : in)
+        {
+            value = random_value<T>();
+        }
+
+        for (int k {}; k < 8; ++k)
+        {
+            auto divisor {random_value<T>() >> static_cast<int>(rng() % 127U)};
+            if (k == 0)
+            {
+                divisor = T{0};
+            }
+            else if (divisor == T{0})
+            {
+                divisor = T{3};
+            }
+
+            std::vector<T> quotients(n);
+            std::vector<T> remainders(n);
+            std::vector<T> combined_quotients(n);
+            std::vector<T> combined_remainders(n);
+
+            divide_n(in.data(), n, divisor, quotients.data());
+            remainder_n(in.data(), n, divisor, remainders.data());
+            divmod_n(in.data(), n, divisor, combined_quotients.data(), combined_remainders.data());
+
+            for (std::size_t i {}; i < n; ++i)
+            {
+                const auto expected_quotient {divisor == T{0} ? T{0} : in[i] / divisor};
+                const auto expected_remainder {divisor == T{0} ? T{0} : in[i] - expected_quotient * divisor};
+
+                BOOST_TEST_EQ(quotients[i], expected_quotient);
+                BOOST_TEST_EQ(remainders[i], expected_remainder);
+                BOOST_TEST_EQ(combined_quotients[i], expected_quotient);
+                BOOST_TEST_EQ(combined_remainders[i], expected_remainder);
+            }
+
+            // In place operation is allowed
+            auto in_place {in};
+            divide_n(in_place.data(), n, divisor, in_place.data());
+            BOOST_TEST(in_place == quotients);
+        }
+    }
+}
+
+template <typename T>
+void test_element_wise()
+{
+    for (const auto n : sizes)
+    {
+        std::vector<T> lhs(n);
+        std::vector<T> rhs(n);
+        for (std::size_t i {}; i < n; ++i)
+        {
+            lhs[i] = random_value<T>();
+            rhs[i] = (i % 7U == 0U) ? T{0} : random_value<T>() >> static_cast<int>(rng() % 127U);
+        }
+
+        std::vector<T> quotients(n);
+        std::vector<T> remainders(n);
+        std::vector<T> combined_quotients(n);
+        std::vector<T> combined_remainders(n);
+
+        divide_n(lhs.data(), rhs.data(), n, quotients.data());
+        remainder_n(lhs.data(), rhs.data(), n, remainders.data());
+        divmod_n(lhs.data(), rhs.data(), n, combined_quotients.data(), combined_remainders.data());
+
+        for (std::size_t i {}; i < n; ++i)
+        {
+            const auto expected_quotient {lhs[i] / rhs[i]};
+            const auto expected_remainder {rhs[i] == T{0} ? T{0} : lhs[i] - expected_quotient * rhs[i]};
+
+            BOOST_TEST_EQ(quotients[i], expected_quotient);
+            BOOST_TEST_EQ(remainders[i], expected_remainder);
+            BOOST_TEST_EQ(combined_quotients[i], expected_quotient);
+            BOOST_TEST_EQ(combined_remainders[i], expected_remainder);
+        }
+    }
+}
+
+int main()
+{
+    test_single_divisor<uint128_t>();
+    test_single_divisor<int128_t>();
+
+    test_element_wise<uint128_t>();
+    test_element_wise<int128_t>();
+
+    return boost::report_errors();
+}
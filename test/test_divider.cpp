@@ -0,0 +1,250 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/divider.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "random_u128.hpp"
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+constexpr std::size_t N = 1024;
+
+template <bool Branchfree>
+void test_unsigned_divisor(const uint128_t d)
+{
+    const divider<uint128_t, Branchfree> div {d};
+    BOOST_TEST_EQ(div.divisor(), d);
+
+    const uint128_t edge_numerators[] {
+        uint128_t{0}, uint128_t{1}, d - 1U, d, d + 1U,
+        (std::numeric_limits<uint128_t>::max)(),
+        (std::numeric_limits<uint128_t>::max)() - 1U,
+        (std::numeric_limits<uint128_t>::max)() / d * d
+    };
+
+    for (const auto n : edge_numerators)
+    {
+        BOOST_TEST_EQ(div.divide(n), n / d);
+        BOOST_TEST_EQ(div.remainder(n), n % d);
+    }
+
+    for (std::size_t i {}; i < N / 16; ++i)
+    {
+        const auto n {random_u128(static_cast<int>(rng() % 128U) + 1)};
+
+        uint128_t rem {};
+        const auto q {div.divmod(n, rem)};
+
+        BOOST_TEST_EQ(q, n / d);
+        BOOST_TEST_EQ(rem, n % d);
+        BOOST_TEST_EQ(n / div, n / d);
+        BOOST_TEST_EQ(n % div, n % d);
+    }
+}
+
+void test_unsigned()
+{
+    const uint128_t edge_divisors[] {
+        uint128_t{2}, uint128_t{3}, uint128_t{5}, uint128_t{7}, uint128_t{10},
+        uint128_t{641}, uint128_t{UINT32_MAX}, uint128_t{UINT32_MAX} + 1U,
+        uint128_t{10000000000000000000ULL}, uint128_t{UINT64_MAX}, uint128_t{1, 0}, uint128_t{1, 1},
+        uint128_t{1} << 127, (uint128_t{1} << 127) + 1U,
+        (std::numeric_limits<uint128_t>::max)(), (std::numeric_limits<uint128_t>::max)() - 1U
+    };
+
+    test_unsigned_divisor<false>(uint128_t{1});
+
+    for (const auto d : edge_divisors)
+    {
+        test_unsigned_divisor<false>(d);
+        test_unsigned_divisor<true>(d);
+    }
+
+    for (const int bits : {32, 64, 96, 128})
+    {
+        for (std::size_t i {}; i < N / 16; ++i)
+        {
+            auto d {random_u128(bits)};
+            if (d < 2U)
+            {
+                d = 2U;
+            }
+
+            test_unsigned_divisor<false>(d);
+            test_unsigned_divisor<true>(d);
+        }
+    }
+}
+
+// Reference values computed on the magnitudes so that min is handled for every divisor
+int128_t reference_div(const int128_t n, const int128_t d)
+{
+    const auto abs_n {static_cast<uint128_t>(abs(n))};
+    const auto abs_d {static_cast<uint128_t>(abs(d))};
+    const auto q {abs_n / abs_d};
+
+    return static_cast<int128_t>((n < 0) != (d < 0) ? uint128_t{0} - q : q);
+}
+
+int128_t reference_mod(const int128_t n, const int128_t d)
+{
+    return n - reference_div(n, d) * d;
+}
+
+template <bool Branchfree>
+void test_signed_divisor(const int128_t d)
+{
+    const divider<int128_t, Branchfree> div {d};
+    BOOST_TEST_EQ(div.divisor(), d);
+
+    // Negating min overflows, so the opposite divisor is formed with a wrapping subtraction
+    const int128_t edge_numerators[] {
+        int128_t{0}, int128_t{1}, int128_t{-1}, d, int128_t{0} - d, d - 1, d + 1,
+        (std::numeric_limits<int128_t>::max)(),
+        (std::numeric_limits<int128_t>::min)() + 1
+    };
+
+    for (const auto n : edge_numerators)
+    {
+        BOOST_TEST_EQ(div.divide(n), reference_div(n, d));
+        BOOST_TEST_EQ(div.remainder(n), reference_mod(n, d));
+    }
+
+    // The only overflowing case is min / -1
+    if (d != -1)
+    {
+        const auto n {(std::numeric_limits<int128_t>::min)()};
+        BOOST_TEST_EQ(div.divide(n), reference_div(n, d));
+        BOOST_TEST_EQ(div.remainder(n), reference_mod(n, d));
+    }
+
+    for (std::size_t i {}; i < N / 16; ++i)
+    {
+        const auto n {static_cast<int128_t>(random_u128(static_cast<int>(rng() % 128U) + 1)) * ((rng() & 1U) ? 1 : -1)};
+
+        int128_t rem {};
+        const auto q {div.divmod(n, rem)};
+
+        BOOST_TEST_EQ(q, reference_div(n, d));
+        BOOST_TEST_EQ(rem, reference_mod(n, d));
+        BOOST_TEST_EQ(n / div, reference_div(n, d));
+        BOOST_TEST_EQ(n % div, reference_mod(n, d));
+    }
+}
+
+void test_signed()
+{
+    const int128_t edge_divisors[] {
+        int128_t{1}, int128_t{2}, int128_t{3}, int128_t{7}, int128_t{10}, int128_t{INT32_MAX},
+        int128_t{INT64_MAX}, int128_t{1, 0}, int128_t{1} << 126,
+        (std::numeric_limits<int128_t>::max)(), (std::numeric_limits<int128_t>::min)(),
+        (std::numeric_limits<int128_t>::min)() + 1
+    };
+
+    for (const auto d : edge_divisors)
+    {
+        test_signed_divisor<false>(d);
+        test_signed_divisor<true>(d);
+
+        if (d != (std::numeric_limits<int128_t>::min)())
+        {
+            test_signed_divisor<false>(-d);
+            test_signed_divisor<true>(-d);
+        }
+    }
+
+    for (const int bits : {32, 64, 96, 127})
+    {
+        for (std::size_t i {}; i < N / 16; ++i)
+        {
+            auto d {static_cast<int128_t>(random_u128(bits))};
+            if (d == 0)
+            {
+                d = 1;
+            }
+            if (rng() & 1U)
+            {
+                d = -d;
+            }
+
+            test_signed_divisor<false>(d);
+            test_signed_divisor<true>(d);
+        }
+    }
+}
+
+template <detail::constant_divisor_type Divisor>
+void test_constant_divisor()
+{
+    const uint128_t d {Divisor};
+    const int128_t signed_d {static_cast<int128_t>(d)};
+
+    for (std::size_t i {}; i < N / 4; ++i)
+    {
+        const auto n {random_u128(static_cast<int>(rng() % 128U) + 1)};
+        BOOST_TEST_EQ(div_by<Divisor>(n), n / d);
+        BOOST_TEST_EQ(mod_by<Divisor>(n), n % d);
+
+        const auto signed_n {static_cast<int128_t>(n)};
+        BOOST_TEST_EQ(div_by<Divisor>(signed_n), reference_div(signed_n, signed_d));
+        BOOST_TEST_EQ(mod_by<Divisor>(signed_n), reference_mod(signed_n, signed_d));
+    }
+
+    BOOST_TEST_EQ(div_by<Divisor>((std::numeric_limits<uint128_t>::max)()), (std::numeric_limits<uint128_t>::max)() / d);
+    BOOST_TEST_EQ(div_by<Divisor>((std::numeric_limits<int128_t>::min)()), reference_div((std::numeric_limits<int128_t>::min)(), signed_d));
+    BOOST_TEST_EQ(mod_by<Divisor>((std::numeric_limits<int128_t>::min)()), reference_mod((std::numeric_limits<int128_t>::min)(), signed_d));
+}
+
+void test_constant_divisors()
+{
+    test_constant_divisor<1U>();
+    test_constant_divisor<3U>();
+    test_constant_divisor<10U>();
+    test_constant_divisor<16U>();
+    test_constant_divisor<1000U>();
+    test_constant_divisor<UINT64_C(864000000000000)>();
+    test_constant_divisor<UINT64_C(10000000000000000000)>();
+    test_constant_divisor<UINT64_MAX>();
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    constexpr uint128_divider u_div {uint128_t{10U}};
+    static_assert(u_div.divide(uint128_t{12345U}) == 1234U, "Wrong");
+    static_assert(u_div.remainder(uint128_t{12345U}) == 5U, "Wrong");
+
+    constexpr int128_branchfree_divider i_div {int128_t{-7}};
+    static_assert(i_div.divide(int128_t{100}) == -14, "Wrong");
+    static_assert(i_div.remainder(int128_t{100}) == 2, "Wrong");
+
+    static_assert(div_by<10U>(uint128_t{12345U}) == 1234U, "Wrong");
+    static_assert(mod_by<1000U>(uint128_t{12345U}) == 345U, "Wrong");
+    static_assert(div_by<7U>(int128_t{-100}) == -14, "Wrong");
+    static_assert(mod_by<7U>(int128_t{-100}) == -2, "Wrong");
+
+    // min / 1 is the one quotient whose magnitude does not fit into int128_t
+    static_assert(div_by<1U>((std::numeric_limits<int128_t>::min)()) == (std::numeric_limits<int128_t>::min)(), "Wrong");
+    static_assert(mod_by<1U>((std::numeric_limits<int128_t>::min)()) == 0, "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_unsigned();
+    test_signed();
+    test_constant_divisors();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
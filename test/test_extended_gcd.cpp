@@ -0,0 +1,210 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "random_u128.hpp"
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+constexpr std::size_t N = 1024;
+
+// Two's complement 256-bit value
+struct wide
+{
+    uint128_t hi;
+    uint128_t lo;
+};
+
+wide signed_product(const uint128_t a, const int128_t x)
+{
+    const auto magnitude {x < 0 ? -static_cast<uint128_t>(x) : static_cast<uint128_t>(x)};
+    const auto product {mul_wide(a, magnitude)};
+
+    if (x < 0)
+    {
+        // Negate the 256-bit value
+        const auto lo {~product.lo + 1U};
+        const auto hi {~product.hi + static_cast<std::uint64_t>(lo == 0U)};
+        return {hi, lo};
+    }
+
+    return {product.hi, product.lo};
+}
+
+wide add(const wide lhs, const wide rhs)
+{
+    const auto lo {lhs.lo + rhs.lo};
+    return {lhs.hi + rhs.hi + static_cast<std::uint64_t>(lo < lhs.lo), lo};
+}
+
+uint128_t reference_gcd(uint128_t a, uint128_t b)
+{
+    while (b != 0U)
+    {
+        const auto r {a % b};
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+int128_t abs_bound(const uint128_t value, const uint128_t g)
+{
+    // |x| <= max(1, b / 2g)
+    const auto bound {value / g / 2U};
+    return bound == 0U ? int128_t{1} : static_cast<int128_t>(bound);
+}
+
+void check_unsigned(const uint128_t a, const uint128_t b)
+{
+    const auto result {extended_gcd(a, b)};
+    BOOST_TEST_EQ(result.g, reference_gcd(a, b));
+
+    // a * x + b * y == g exactly
+    const auto sum {add(signed_product(a, result.x), signed_product(b, result.y))};
+    BOOST_TEST_EQ(sum.hi, 0U);
+    BOOST_TEST_EQ(sum.lo, result.g);
+
+    if (result.g != 0U)
+    {
+        BOOST_TEST(abs(result.x) <= abs_bound(b, result.g));
+        BOOST_TEST(abs(result.y) <= abs_bound(a, result.g));
+    }
+}
+
+void test_unsigned()
+{
+    constexpr auto max_value {(std::numeric_limits<uint128_t>::max)()};
+    const uint128_t edge_values[] {
+        uint128_t{0}, uint128_t{1}, uint128_t{2}, uint128_t{3}, uint128_t{UINT64_MAX}, uint128_t{1, 0},
+        uint128_t{1, 1}, uint128_t{1} << 127, (uint128_t{1} << 127) - 1U, max_value, max_value - 1U
+    };
+
+    for (const auto a : edge_values)
+    {
+        for (const auto b : edge_values)
+        {
+            check_unsigned(a, b);
+        }
+    }
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto a {random_u128(static_cast<int>(rng() % 128U) + 1)};
+        const auto b {random_u128(static_cast<int>(rng() % 128U) + 1)};
+        check_unsigned(a, b);
+
+        // Large common factors
+        const auto g {random_u128(static_cast<int>(rng() % 64U) + 1)};
+        check_unsigned(a * g, b * g);
+        check_unsigned(random_u128(64) * g, random_u128(64) * g);
+    }
+
+    // Consecutive Fibonacci numbers maximize the number of quotient steps
+    uint128_t f0 {1};
+    uint128_t f1 {1};
+    while (f1 < max_value - f0)
+    {
+        const auto f2 {f0 + f1};
+        f0 = f1;
+        f1 = f2;
+    }
+    check_unsigned(f1, f0);
+    check_unsigned(f0, f1);
+}
+
+void test_signed()
+{
+    const int128_t values[] {
+        int128_t{0}, int128_t{1}, int128_t{-1}, int128_t{12}, int128_t{-18}, int128_t{INT64_MIN},
+        (std::numeric_limits<int128_t>::max)(), (std::numeric_limits<int128_t>::min)() + 1
+    };
+
+    for (const auto a : values)
+    {
+        for (const auto b : values)
+        {
+            const auto result {extended_gcd(a, b)};
+            BOOST_TEST_EQ(static_cast<uint128_t>(result.g), reference_gcd(static_cast<uint128_t>(abs(a)), static_cast<uint128_t>(abs(b))));
+            BOOST_TEST_EQ(a * result.x + b * result.y, result.g);
+        }
+    }
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto a {static_cast<int128_t>(random_u128(static_cast<int>(rng() % 120U) + 1)) * ((rng() & 1U) ? 1 : -1)};
+        const auto b {static_cast<int128_t>(random_u128(static_cast<int>(rng() % 120U) + 1)) * ((rng() & 1U) ? 1 : -1)};
+
+        const auto result {extended_gcd(a, b)};
+        BOOST_TEST_EQ(static_cast<uint128_t>(result.g), reference_gcd(static_cast<uint128_t>(abs(a)), static_cast<uint128_t>(abs(b))));
+        BOOST_TEST_EQ(a * result.x + b * result.y, result.g);
+    }
+}
+
+void test_mod_inverse()
+{
+    BOOST_TEST(!mod_inverse(uint128_t{3}, uint128_t{0}));
+    BOOST_TEST(!mod_inverse(uint128_t{6}, uint128_t{9}));
+    BOOST_TEST(!mod_inverse(uint128_t{0}, uint128_t{7}));
+    BOOST_TEST(mod_inverse(uint128_t{5}, uint128_t{1}));
+    BOOST_TEST_EQ(mod_inverse(uint128_t{5}, uint128_t{1}).value, 0U);
+    BOOST_TEST_EQ(mod_inverse(uint128_t{3}, uint128_t{7}).value, 5U);
+
+    constexpr auto max_value {(std::numeric_limits<uint128_t>::max)()};
+    const uint128_t moduli[] {uint128_t{2}, uint128_t{1000000007}, uint128_t{UINT64_MAX}, uint128_t{1, 13},
+                              (uint128_t{1} << 127) - 1U, uint128_t{1} << 127, max_value};
+
+    for (const auto m : moduli)
+    {
+        for (std::size_t i {}; i < N / 8U; ++i)
+        {
+            const auto a {random_u128(static_cast<int>(rng() % 128U) + 1)};
+            const auto inverse {mod_inverse(a, m)};
+
+            BOOST_TEST_EQ(static_cast<bool>(inverse), reference_gcd(a, m) == 1U);
+            if (inverse)
+            {
+                BOOST_TEST(inverse.value < m);
+                BOOST_TEST_EQ(reference_mulmod(a % m, inverse.value, m), 1U % m);
+            }
+        }
+    }
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    constexpr auto result {extended_gcd(uint128_t{240}, uint128_t{46})};
+    static_assert(result.g == 2U, "Wrong");
+    static_assert(result.x == -9, "Wrong");
+    static_assert(result.y == 47, "Wrong");
+
+    constexpr auto signed_result {extended_gcd(int128_t{-240}, int128_t{46})};
+    static_assert(signed_result.g == 2, "Wrong");
+    static_assert(signed_result.x == 9, "Wrong");
+
+    static_assert(mod_inverse(uint128_t{3}, uint128_t{1000000007}).value == 333333336U, "Wrong");
+    static_assert(!mod_inverse(uint128_t{4}, uint128_t{1000}), "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_unsigned();
+    test_signed();
+    test_mod_inverse();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,178 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// The tests do not link against {fmt}
+#define FMT_HEADER_ONLY
+
+#include <boost/int128.hpp>
+#include <boost/int128/format.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <type_traits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng {42};
+
+constexpr std::size_t N {256};
+
+// Covers every type, flag and alignment, and the zero flag with and without an alignment
+static const char* const specs[] {
+    "{}", "{:d}", "{:x}", "{:X}", "{:o}", "{:b}", "{:B}",
+    "{:#x}", "{:#X}", "{:#o}", "{:#b}", "{:#B}", "{:#d}",
+    "{:+}", "{: }", "{:-}", "{:+#x}", "{: #o}",
+    "{:1}", "{:50}", "{:<50}", "{:>50}", "{:^50}", "{:^51}",
+    "{:*<45}", "{:*>45x}", "{:_^60b}", "{:0^50}",
+    "{:050}", "{:+050}", "{:#050x}", "{:#0140b}"
+};
+
+uint128_t random_u128()
+{
+    return uint128_t{rng(), rng()} >> static_cast<int>(rng() % 128U);
+}
+
+#ifdef BOOST_INT128_HAS_FMT_FORMAT
+
+#if defined(__SIZEOF_INT128__) && FMT_USE_INT128
+
+// {fmt} formats the builtin types itself, which gives the expected text for every value
+unsigned __int128 to_builtin(const uint128_t value)
+{
+    return static_cast<unsigned __int128>(value.high) << 64 | value.low;
+}
+
+__int128 to_builtin(const int128_t value)
+{
+    return static_cast<__int128>(to_builtin(static_cast<uint128_t>(value)));
+}
+
+// Unlike std::format, {fmt} only allows a sign for the signed builtin types
+bool has_sign(const std::string& spec)
+{
+    return spec.find_first_of("+- ") != std::string::npos;
+}
+
+template <typename T>
+void check_fmt(const T value)
+{
+    for (const auto spec : specs)
+    {
+        if (std::is_same<T, uint128_t>::value && has_sign(spec))
+        {
+            continue;
+        }
+
+        BOOST_TEST_EQ(fmt::format(fmt::runtime(spec), value), fmt::format(fmt::runtime(spec), to_builtin(value)));
+    }
+}
+
+void test_fmt_against_builtin()
+{
+    check_fmt((std::numeric_limits<uint128_t>::max)());
+    check_fmt((std::numeric_limits<int128_t>::min)());
+    check_fmt((std::numeric_limits<int128_t>::max)());
+    check_fmt(uint128_t{0});
+    check_fmt(int128_t{0});
+    check_fmt(int128_t{-1});
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto value {random_u128()};
+        check_fmt(value);
+        check_fmt((rng() & 1U) ? -static_cast<int128_t>(value >> 1) : static_cast<int128_t>(value >> 1));
+    }
+}
+
+#endif
+
+void test_fmt()
+{
+    const auto max {(std::numeric_limits<uint128_t>::max)()};
+
+    // Checked at compile time from C++20
+    BOOST_TEST_EQ(fmt::format("{}", max), "340282366920938463463374607431768211455");
+    BOOST_TEST_EQ(fmt::format("{:#X}", max), "0XFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+    BOOST_TEST_EQ(fmt::format("{:*^9}", int128_t{-42}), "***-42***");
+    BOOST_TEST_EQ(fmt::format("{:+08d}", int128_t{42}), "+0000042");
+    BOOST_TEST_EQ(fmt::format("{:#010b}", uint128_t{5}), "0b00000101");
+    BOOST_TEST_EQ(fmt::format("{:#o}", uint128_t{8}), "010");
+    BOOST_TEST_EQ(fmt::format("{:#o}", uint128_t{0}), "0");
+    BOOST_TEST_EQ(fmt::format("{:<6}|", uint128_t{7}), "7     |");
+    BOOST_TEST_EQ(fmt::format("{:x} {}", uint128_t{255}, int128_t{-3}), "ff -3");
+    BOOST_TEST_EQ(fmt::format("{:+} {: }", uint128_t{1}, uint128_t{2}), "+1  2");
+    BOOST_TEST_EQ(fmt::format("{}", (std::numeric_limits<int128_t>::min)()), "-170141183460469231731687303715884105728");
+
+    // As in std::format, the zero flag is ignored with an alignment
+    BOOST_TEST_EQ(fmt::format("{:*<06}", uint128_t{42}), "42****");
+
+    for (const auto spec : {"{:.3}", "{:L}", "{:c}", "{:e}", "{:{}}", "{:5x5}", "{:{<5}"})
+    {
+        BOOST_TEST_THROWS(static_cast<void>(fmt::format(fmt::runtime(spec), max, 5)), fmt::format_error);
+    }
+
+    #if defined(__SIZEOF_INT128__) && FMT_USE_INT128
+    test_fmt_against_builtin();
+    #endif
+}
+
+#endif // BOOST_INT128_HAS_FMT_FORMAT
+
+#ifdef BOOST_INT128_HAS_FORMAT
+
+template <typename T>
+std::string std_vformat(const char* spec, const T value)
+{
+    return std::vformat(spec, std::make_format_args(value));
+}
+
+void test_std_format()
+{
+    const auto max {(std::numeric_limits<uint128_t>::max)()};
+
+    // Checked at compile time
+    BOOST_TEST_EQ(std::format("{}", max), "340282366920938463463374607431768211455");
+    BOOST_TEST_EQ(std::format("{:#X}", max), "0XFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+    BOOST_TEST_EQ(std::format("{:*^9}", int128_t{-42}), "***-42***");
+    BOOST_TEST_EQ(std::format("{:+08d}", int128_t{42}), "+0000042");
+    BOOST_TEST_EQ(std::format("{:#010b}", uint128_t{5}), "0b00000101");
+    BOOST_TEST_EQ(std::format("{:#o}", uint128_t{0}), "0");
+    BOOST_TEST_EQ(std::format("{}", (std::numeric_limits<int128_t>::min)()), "-170141183460469231731687303715884105728");
+    BOOST_TEST_EQ(std::format("{:*<06}", uint128_t{42}), "42****");
+
+    // Values that fit in 64 bits format the same as the builtin types
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto value {rng() >> (rng() % 64U)};
+        const auto signed_value {(rng() & 1U) ? -static_cast<std::int64_t>(value >> 1U) : static_cast<std::int64_t>(value >> 1U)};
+
+        for (const auto spec : specs)
+        {
+            BOOST_TEST_EQ(std_vformat(spec, uint128_t{value}), std_vformat(spec, value));
+            BOOST_TEST_EQ(std_vformat(spec, int128_t{signed_value}), std_vformat(spec, signed_value));
+        }
+    }
+
+    for (const auto spec : {"{:.3}", "{:L}", "{:c}", "{:e}", "{:5x5}", "{:{<5}"})
+    {
+        BOOST_TEST_THROWS(static_cast<void>(std_vformat(spec, max)), std::format_error);
+    }
+}
+
+#endif // BOOST_INT128_HAS_FORMAT
+
+int main()
+{
+    #ifdef BOOST_INT128_HAS_FMT_FORMAT
+    test_fmt();
+    #endif
+
+    #ifdef BOOST_INT128_HAS_FORMAT
+    test_std_format();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,161 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng {42};
+
+constexpr std::size_t N {1024};
+
+template <typename T>
+std::string format(const T value)
+{
+    char buffer[64] {};
+    const auto r {to_chars(buffer, buffer + sizeof(buffer), value)};
+    return std::string(buffer, r.ptr);
+}
+
+uint128_t random_u128()
+{
+    return uint128_t{rng(), rng()} >> static_cast<int>(rng() % 128U);
+}
+
+template <typename T>
+std::vector<T> random_values(const std::size_t n);
+
+template <>
+std::vector<uint128_t> random_values<uint128_t>(const std::size_t n)
+{
+    std::vector<uint128_t> values {0U, (std::numeric_limits<uint128_t>::max)()};
+    while (values.size() < n)
+    {
+        values.push_back(random_u128());
+    }
+
+    values.resize(n);
+    return values;
+}
+
+template <>
+std::vector<int128_t> random_values<int128_t>(const std::size_t n)
+{
+    std::vector<int128_t> values {(std::numeric_limits<int128_t>::min)(), (std::numeric_limits<int128_t>::max)(), 0, -1};
+    while (values.size() < n)
+    {
+        const auto value {static_cast<int128_t>(random_u128() >> 1)};
+        values.push_back((rng() & 1U) ? -value : value);
+    }
+
+    values.resize(n);
+    return values;
+}
+
+template <typename T>
+void test_separated()
+{
+    for (const auto n : {std::size_t{0}, std::size_t{1}, std::size_t{2}, N})
+    {
+        const auto values {random_values<T>(n)};
+
+        std::string expected;
+        for (std::size_t i {}; i < n; ++i)
+        {
+            if (i != 0U)
+            {
+                expected.push_back(',');
+            }
+            expected += format(values[i]);
+        }
+
+        BOOST_TEST_EQ(format_n_size(values.data(), n), expected.size());
+
+        // A guard character checks that nothing is written past the exact size
+        std::string buffer(expected.size() + 1U, '#');
+        const auto end {format_n(values.data(), n, &buffer[0], ',')};
+
+        BOOST_TEST(end == buffer.data() + expected.size());
+        BOOST_TEST_EQ(buffer.substr(0, expected.size()), expected);
+        BOOST_TEST_EQ(buffer.back(), '#');
+    }
+}
+
+template <typename T>
+void test_offsets()
+{
+    for (const auto n : {std::size_t{0}, std::size_t{1}, N})
+    {
+        const auto values {random_values<T>(n)};
+
+        // Without separators the output is shorter by n - 1, and a guard character follows it
+        const auto size {format_n_size(values.data(), n) - (n == 0U ? 0U : n - 1U)};
+        std::string buffer(size + 1U, '#');
+        std::vector<std::size_t> offsets(n + 1U, SIZE_MAX);
+        const auto end {format_n(values.data(), n, &buffer[0], offsets.data())};
+
+        BOOST_TEST_EQ(offsets.front(), 0U);
+        BOOST_TEST_EQ(offsets.back(), size);
+        BOOST_TEST(end == buffer.data() + size);
+        BOOST_TEST_EQ(buffer.back(), '#');
+
+        for (std::size_t i {}; i < n; ++i)
+        {
+            BOOST_TEST_EQ(buffer.substr(offsets[i], offsets[i + 1U] - offsets[i]), format(values[i]));
+        }
+    }
+}
+
+constexpr bool constexpr_format_n()
+{
+    const int128_t values[] {int128_t{12}, int128_t{-7}, int128_t{UINT64_C(1234567890123456789)} * 1000 + 42};
+    const char expected[] {"12\n-7\n1234567890123456789042"};
+
+    // Exactly format_n_size characters, so any write past the end fails constant evaluation
+    char buffer[sizeof(expected) - 1U] {};
+    const auto end {format_n(values, 3U, buffer, '\n')};
+
+    for (std::size_t i {}; i < sizeof(buffer); ++i)
+    {
+        if (buffer[i] != expected[i])
+        {
+            return false;
+        }
+    }
+
+    if (end != buffer + sizeof(buffer) || format_n_size(values, 3U) != sizeof(buffer))
+    {
+        return false;
+    }
+
+    // The offsets form needs two characters fewer than that without the separators
+    char column[sizeof(buffer) - 2U] {};
+    std::size_t offsets[4] {};
+    return format_n(values, 3U, column, offsets) == column + sizeof(column) &&
+           offsets[1] == 2U && offsets[2] == 4U && offsets[3] == sizeof(column) &&
+           column[2] == '-' && column[3] == '7';
+}
+
+void test_constexpr()
+{
+    static_assert(constexpr_format_n(), "Wrong");
+}
+
+int main()
+{
+    test_separated<uint128_t>();
+    test_separated<int128_t>();
+    test_offsets<uint128_t>();
+    test_offsets<int128_t>();
+    test_constexpr();
+
+    return boost::report_errors();
+}
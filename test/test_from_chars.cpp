@@ -0,0 +1,188 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng {42};
+
+constexpr std::size_t N {1024};
+
+// One digit per division, with random case for the letters
+std::string reference_to_chars(uint128_t value, const unsigned base)
+{
+    std::string result;
+    do
+    {
+        const auto digit {static_cast<unsigned>(value % base)};
+        const auto letter {(rng() & 1U) ? 'a' : 'A'};
+        result.push_back(static_cast<char>(digit < 10U ? '0' + digit : letter + digit - 10U));
+        value /= base;
+    } while (value != 0U);
+
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+uint128_t random_u128()
+{
+    return uint128_t{rng(), rng()} >> static_cast<int>(rng() % 128U);
+}
+
+template <typename T>
+void check_parse(const std::string& str, const int base, const T expected, const std::size_t length)
+{
+    T value {};
+    const auto r {from_chars(str.data(), str.data() + str.size(), value, base)};
+    BOOST_TEST(r.ec == std::errc{});
+    BOOST_TEST(static_cast<bool>(r));
+    BOOST_TEST(r.ptr == str.data() + length);
+    BOOST_TEST_EQ(value, expected);
+}
+
+template <typename T>
+void check_error(const std::string& str, const int base, const std::errc ec, const std::size_t length)
+{
+    // The value is left alone on failure
+    T value {42};
+    const auto r {from_chars(str.data(), str.data() + str.size(), value, base)};
+    BOOST_TEST(r.ec == ec);
+    BOOST_TEST(r.ptr == str.data() + length);
+    BOOST_TEST_EQ(value, T{42});
+}
+
+void test_unsigned()
+{
+    for (int base {2}; base <= 36; ++base)
+    {
+        const auto unsigned_base {static_cast<unsigned>(base)};
+        const auto max {(std::numeric_limits<uint128_t>::max)()};
+
+        const auto max_str {reference_to_chars(max, unsigned_base)};
+        check_parse(max_str, base, max, max_str.size());
+
+        // One more than the maximum
+        auto over {max_str};
+        over.push_back('0');
+        check_error<uint128_t>(over, base, std::errc::result_out_of_range, over.size());
+
+        for (std::size_t i {}; i < N / 8U; ++i)
+        {
+            const auto value {random_u128()};
+            const auto str {reference_to_chars(value, unsigned_base)};
+            check_parse(str, base, value, str.size());
+
+            // Parsing stops at the first character that is not a digit of the base
+            const std::string stop {base == 36 ? "/" : "z"};
+            check_parse(str + stop + "1", base, value, str.size());
+        }
+    }
+
+    check_parse<uint128_t>("340282366920938463463374607431768211455", 10, (std::numeric_limits<uint128_t>::max)(), 39U);
+    check_error<uint128_t>("340282366920938463463374607431768211456", 10, std::errc::result_out_of_range, 39U);
+    check_error<uint128_t>("500000000000000000000000000000000000000", 10, std::errc::result_out_of_range, 39U);
+    check_error<uint128_t>("1000000000000000000000000000000000000000000000000000000000000x", 10, std::errc::result_out_of_range, 61U);
+
+    // Leading zeros fill whole chunks without contributing to the value
+    const std::string zeros(100, '0');
+    check_parse<uint128_t>(zeros + "123", 10, uint128_t{123}, 103U);
+    check_parse<uint128_t>(zeros, 10, uint128_t{0}, 100U);
+
+    check_parse<uint128_t>("ffFF", 16, uint128_t{0xFFFF}, 4U);
+    check_parse<uint128_t>("0x1", 16, uint128_t{0}, 1U);
+    check_parse<uint128_t>("12 34", 10, uint128_t{12}, 2U);
+
+    check_error<uint128_t>("", 10, std::errc::invalid_argument, 0U);
+    check_error<uint128_t>("-1", 10, std::errc::invalid_argument, 0U);
+    check_error<uint128_t>("+1", 10, std::errc::invalid_argument, 0U);
+    check_error<uint128_t>(" 1", 10, std::errc::invalid_argument, 0U);
+    check_error<uint128_t>("2", 2, std::errc::invalid_argument, 0U);
+}
+
+void test_signed()
+{
+    const auto min {(std::numeric_limits<int128_t>::min)()};
+    const auto max {(std::numeric_limits<int128_t>::max)()};
+
+    check_parse<int128_t>("-170141183460469231731687303715884105728", 10, min, 40U);
+    check_parse<int128_t>("170141183460469231731687303715884105727", 10, max, 39U);
+    check_error<int128_t>("-170141183460469231731687303715884105729", 10, std::errc::result_out_of_range, 40U);
+    check_error<int128_t>("170141183460469231731687303715884105728", 10, std::errc::result_out_of_range, 39U);
+    check_parse<int128_t>("-80000000000000000000000000000000", 16, min, 33U);
+    check_error<int128_t>("80000000000000000000000000000000", 16, std::errc::result_out_of_range, 32U);
+    check_parse<int128_t>("-0", 10, int128_t{0}, 2U);
+
+    check_error<int128_t>("-", 10, std::errc::invalid_argument, 0U);
+    check_error<int128_t>("--1", 10, std::errc::invalid_argument, 0U);
+    check_error<int128_t>("+1", 10, std::errc::invalid_argument, 0U);
+
+    for (const auto base : {2, 7, 10, 16, 36})
+    {
+        for (std::size_t i {}; i < N / 4U; ++i)
+        {
+            const auto magnitude {random_u128() >> 1U};
+            const auto negative {(rng() & 1U) != 0U};
+            const auto str {(negative ? "-" : "") + reference_to_chars(magnitude, static_cast<unsigned>(base))};
+            const auto expected {negative ? -static_cast<int128_t>(magnitude) : static_cast<int128_t>(magnitude)};
+            check_parse(str, base, expected, str.size());
+        }
+    }
+}
+
+void test_round_trip()
+{
+    char buffer[64] {};
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto value {random_u128()};
+        const auto to {to_chars(buffer, buffer + sizeof(buffer), value)};
+
+        uint128_t parsed {};
+        const auto from {from_chars(buffer, to.ptr, parsed)};
+        BOOST_TEST(from.ec == std::errc{});
+        BOOST_TEST(from.ptr == to.ptr);
+        BOOST_TEST_EQ(parsed, value);
+    }
+}
+
+void test_legacy_overflow()
+{
+    // The old parser accepted values between 2^128 and 10^39 and wrapped them
+    const char str[] {"500000000000000000000000000000000000000"};
+    uint128_t value {7};
+    BOOST_TEST_EQ(detail::from_chars(str, str + sizeof(str) - 1U, value), EDOM);
+    BOOST_TEST_EQ(value, 7U);
+}
+
+constexpr bool constexpr_from_chars()
+{
+    const char str[] {"-12345678901234567890123"};
+    int128_t value {};
+    const auto r {from_chars(str, str + sizeof(str) - 1U, value)};
+    return r.ec == std::errc{} && value == -int128_t{UINT64_C(1234567890123456789)} * 10000 - 123;
+}
+
+void test_constexpr()
+{
+    static_assert(constexpr_from_chars(), "Wrong");
+}
+
+int main()
+{
+    test_unsigned();
+    test_signed();
+    test_round_trip();
+    test_legacy_overflow();
+    test_constexpr();
+
+    return boost::report_errors();
+}
@@ -5,6 +5,10 @@
 #include <boost/int128.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include <limits>
+#include <random>
+#include <vector>
+#include <list>
+#include <iterator>
 
 using namespace boost::int128;
 
@@ -159,6 +163,122 @@ void test_negative_value()
 #pragma warning(pop)
 #endif
 
+uint128_t reference_gcd(uint128_t a, uint128_t b)
+{
+    while (b != 0U)
+    {
+        const auto r {a % b};
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+void test_lehmer_gcd()
+{
+    std::mt19937_64 rng {42};
+
+    // Small even values against large odd ones used to take one subtraction per step
+    BOOST_TEST_EQ(gcd(uint128_t{2}, (uint128_t{1} << 127) - 1U), 1U);
+    BOOST_TEST_EQ(gcd(uint128_t{6}, (std::numeric_limits<uint128_t>::max)()), 3U);
+    BOOST_TEST_EQ(gcd(uint128_t{1} << 100, uint128_t{3} << 90), uint128_t{1} << 90);
+    BOOST_TEST_EQ(gcd((std::numeric_limits<uint128_t>::max)(), (std::numeric_limits<uint128_t>::max)()), (std::numeric_limits<uint128_t>::max)());
+
+    // Consecutive Fibonacci numbers give the longest run of unit quotients
+    uint128_t f0 {1};
+    uint128_t f1 {1};
+    while (f1 < (std::numeric_limits<uint128_t>::max)() - f0)
+    {
+        const auto f2 {f0 + f1};
+        f0 = f1;
+        f1 = f2;
+    }
+    BOOST_TEST_EQ(gcd(f1, f0), 1U);
+    BOOST_TEST_EQ(gcd(f0, f1 - f0), 1U);
+
+    for (std::size_t i {}; i < 1024U; ++i)
+    {
+        const auto a_bits {static_cast<int>(rng() % 128U) + 1};
+        const auto b_bits {static_cast<int>(rng() % 128U) + 1};
+        const uint128_t a_value {rng(), rng()};
+        const uint128_t b_value {rng(), rng()};
+        auto a {a_bits == 128 ? a_value : a_value & ((uint128_t{1} << a_bits) - 1U)};
+        auto b {b_bits == 128 ? b_value : b_value & ((uint128_t{1} << b_bits) - 1U)};
+
+        BOOST_TEST_EQ(gcd(a, b), reference_gcd(a, b));
+
+        // Common factors
+        const uint128_t g {rng() >> (rng() % 64U)};
+        a = (a >> 64U) * g;
+        b = (b >> 64U) * g;
+        BOOST_TEST_EQ(gcd(a, b), reference_gcd(a, b));
+    }
+}
+
+template <typename T>
+void test_reduce()
+{
+    const T scale {1, 0};
+    std::vector<T> values {T{12} * scale, T{18} * scale, T{30} * scale, T{42} * scale, T{66} * scale};
+
+    BOOST_TEST_EQ(gcd_reduce(values.begin(), values.end()), T{6} * scale);
+    BOOST_TEST_EQ(gcd_reduce(values.begin(), std::next(values.begin())), values.front());
+    BOOST_TEST_EQ(gcd_reduce(values.begin(), values.begin()), T{0});
+
+    values.push_back(T{35});
+    BOOST_TEST_EQ(gcd_reduce(values.begin(), values.end()), T{1});
+
+    values.push_back(T{0});
+    BOOST_TEST_EQ(gcd_reduce(values.data(), values.data() + values.size()), T{1});
+
+    // Input iterators that are not random access, with an odd length to exercise the tail
+    const std::list<T> list {T{4}, T{6}, T{8}};
+    BOOST_TEST_EQ(gcd_reduce(list.begin(), list.end()), T{2});
+    BOOST_TEST_EQ(lcm_reduce(list.begin(), list.end()), T{24});
+
+    const T small[] {T{2}, T{3}, T{4}, T{5}, T{6}, T{7}, T{8}, T{9}, T{10}};
+    BOOST_TEST_EQ(lcm_reduce(small, small + 9), T{2520});
+    BOOST_TEST_EQ(lcm_reduce(small, small), T{1});
+
+    const T with_zero[] {T{2}, T{0}, T{3}};
+    BOOST_TEST_EQ(lcm_reduce(with_zero, with_zero + 3), T{0});
+}
+
+void test_reduce_signed()
+{
+    const int128_t values[] {int128_t{-12}, int128_t{18}, int128_t{-30}};
+    BOOST_TEST_EQ(gcd_reduce(values, values + 3), 6);
+    BOOST_TEST_EQ(lcm_reduce(values, values + 3), 180);
+}
+
+void test_reduce_random()
+{
+    std::mt19937_64 rng {43};
+
+    // Word sized lanes where one or both of them finish before the other
+    const uint128_t lanes[] {uint128_t{6}, uint128_t{10}, uint128_t{12}, uint128_t{25}, uint128_t{18}, uint128_t{30}, uint128_t{9}, uint128_t{20}};
+    BOOST_TEST_EQ(gcd_reduce(lanes, lanes + 4), 1U);
+    BOOST_TEST_EQ(gcd_reduce(lanes + 4, lanes + 8), 1U);
+    BOOST_TEST_EQ(gcd_reduce(lanes, lanes + 3), 2U);
+    BOOST_TEST_EQ(gcd_reduce(lanes + 4, lanes + 6), 6U);
+
+    for (std::size_t n {}; n < 40U; ++n)
+    {
+        const uint128_t g {rng() >> 20U};
+
+        std::vector<uint128_t> values(n);
+        uint128_t expected {0};
+        for (auto& value : values)
+        {
+            value = uint128_t{rng() >> 20U} * g;
+            expected = reference_gcd(expected, value);
+        }
+
+        BOOST_TEST_EQ(gcd_reduce(values.begin(), values.end()), expected);
+    }
+}
+
 int main()
 {
     test_gcd<uint128_t>();
@@ -170,5 +290,11 @@ int main()
     test_gcd_lcm_properties<int128_t>();
     test_negative_value();
 
+    test_lehmer_gcd();
+    test_reduce<uint128_t>();
+    test_reduce<int128_t>();
+    test_reduce_signed();
+    test_reduce_random();
+
     return boost::report_errors();
 }
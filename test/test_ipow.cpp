@@ -0,0 +1,169 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng(42);
+
+constexpr std::size_t N = 1024;
+
+constexpr auto u_max {(std::numeric_limits<uint128_t>::max)()};
+constexpr auto i_max {(std::numeric_limits<int128_t>::max)()};
+constexpr auto i_min {(std::numeric_limits<int128_t>::min)()};
+
+// Bases of a few bits so that exponents on both sides of overflow are common
+uint128_t random_base()
+{
+    return uint128_t{rng(), rng()} >> static_cast<int>(64U + rng() % 64U);
+}
+
+unsigned random_exp()
+{
+    return static_cast<unsigned>(rng() % 140U);
+}
+
+// One multiplication per step, with the overflow flag kept once set
+template <typename T>
+bool reference_pow(const T base, const unsigned exp, T& result)
+{
+    result = T{1};
+    bool overflow {false};
+    for (unsigned i {}; i < exp; ++i)
+    {
+        overflow = ckd_mul(&result, result, base) || overflow;
+    }
+
+    return overflow;
+}
+
+void test_unsigned()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto base {random_base()};
+        const auto exp {random_exp()};
+
+        uint128_t expected {};
+        const auto expected_overflow {reference_pow(base, exp, expected)};
+
+        BOOST_TEST_EQ(ipow(base, exp), expected);
+
+        uint128_t res {};
+        BOOST_TEST_EQ(ckd_pow(&res, base, exp), expected_overflow);
+        BOOST_TEST_EQ(res, expected);
+
+        BOOST_TEST_EQ(pow_sat(base, exp), expected_overflow ? u_max : expected);
+    }
+
+    uint128_t res {};
+
+    BOOST_TEST_EQ(ipow(uint128_t{0}, 0U), 1U);
+    BOOST_TEST_EQ(ipow(uint128_t{0}, 5U), 0U);
+    BOOST_TEST_EQ(ipow(uint128_t{1}, UINT32_MAX), 1U);
+    BOOST_TEST_EQ(ipow(uint128_t{2}, 127U), uint128_t{1} << 127);
+    BOOST_TEST_EQ(ipow(uint128_t{2}, 128U), 0U);
+    BOOST_TEST_EQ(ipow(uint128_t{3}, 80U) / ipow(uint128_t{3}, 79U), 3U);
+
+    BOOST_TEST(!ckd_pow(&res, uint128_t{2}, 127U));
+    BOOST_TEST(ckd_pow(&res, uint128_t{2}, 128U));
+    BOOST_TEST_EQ(res, 0U);
+    BOOST_TEST(!ckd_pow(&res, uint128_t{UINT64_MAX}, 2U));
+    BOOST_TEST(ckd_pow(&res, uint128_t{1} << 64, 2U));
+    BOOST_TEST(!ckd_pow(&res, u_max, 1U));
+    BOOST_TEST(ckd_pow(&res, u_max, 2U));
+    BOOST_TEST_EQ(res, 1U);
+    BOOST_TEST(!ckd_pow(&res, uint128_t{10}, 38U));
+    BOOST_TEST(ckd_pow(&res, uint128_t{10}, 39U));
+
+    BOOST_TEST_EQ(pow_sat(uint128_t{3}, 81U), u_max);
+    BOOST_TEST_EQ(pow_sat(uint128_t{3}, 80U), ipow(uint128_t{3}, 80U));
+    BOOST_TEST_EQ(pow_sat(uint128_t{2}, UINT32_MAX), u_max);
+}
+
+void test_signed()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto magnitude {static_cast<int128_t>(random_base())};
+        const auto base {(rng() & 1U) ? -magnitude : magnitude};
+        const auto exp {random_exp()};
+
+        int128_t expected {};
+        const auto expected_overflow {reference_pow(base, exp, expected)};
+
+        BOOST_TEST_EQ(ipow(base, exp), expected);
+
+        int128_t res {};
+        BOOST_TEST_EQ(ckd_pow(&res, base, exp), expected_overflow);
+        BOOST_TEST_EQ(res, expected);
+
+        const auto negative {base < 0 && (exp & 1U) != 0U};
+        BOOST_TEST_EQ(pow_sat(base, exp), expected_overflow ? (negative ? i_min : i_max) : expected);
+    }
+
+    int128_t res {};
+
+    BOOST_TEST_EQ(ipow(int128_t{-1}, 7U), -1);
+    BOOST_TEST_EQ(ipow(int128_t{-1}, 8U), 1);
+    BOOST_TEST_EQ(ipow(int128_t{-2}, 127U), i_min);
+
+    BOOST_TEST(!ckd_pow(&res, int128_t{-2}, 127U));
+    BOOST_TEST_EQ(res, i_min);
+    BOOST_TEST(ckd_pow(&res, int128_t{2}, 127U));
+    BOOST_TEST_EQ(res, i_min);
+    BOOST_TEST(ckd_pow(&res, int128_t{-2}, 128U));
+    BOOST_TEST_EQ(res, 0);
+    BOOST_TEST(!ckd_pow(&res, i_min, 1U));
+    BOOST_TEST(ckd_pow(&res, i_min, 2U));
+    BOOST_TEST(!ckd_pow(&res, int128_t{-10}, 37U));
+    BOOST_TEST(!ckd_pow(&res, int128_t{10}, 38U));
+    BOOST_TEST(ckd_pow(&res, int128_t{-10}, 39U));
+
+    BOOST_TEST_EQ(pow_sat(int128_t{2}, 127U), i_max);
+    BOOST_TEST_EQ(pow_sat(int128_t{-2}, 127U), i_min);
+    BOOST_TEST_EQ(pow_sat(int128_t{-3}, 81U), i_min);
+    BOOST_TEST_EQ(pow_sat(int128_t{-3}, 82U), i_max);
+}
+
+void test_pow10_table()
+{
+    BOOST_TEST_EQ(pow10_table<uint128_t>.size(), 39U);
+    BOOST_TEST_EQ(pow10_table<int128_t>.size(), 39U);
+
+    uint128_t power {1};
+    for (std::size_t i {}; i < pow10_table<uint128_t>.size(); ++i)
+    {
+        BOOST_TEST_EQ(pow10_table<uint128_t>[i], power);
+        BOOST_TEST_EQ(pow10_table<int128_t>[i], static_cast<int128_t>(power));
+        BOOST_TEST_EQ(ipow(uint128_t{10}, static_cast<unsigned>(i)), power);
+        power *= 10U;
+    }
+
+    BOOST_TEST(pow10_table<int128_t>[38] > 0);
+}
+
+void test_constexpr()
+{
+    static_assert(ipow(uint128_t{10}, 20U) == pow10_table<uint128_t>[20], "Wrong");
+    static_assert(ipow(int128_t{-3}, 3U) == -27, "Wrong");
+    static_assert(pow_sat(uint128_t{10}, 39U) == u_max, "Wrong");
+    static_assert(pow_sat(int128_t{-10}, 39U) == i_min, "Wrong");
+    static_assert(pow10_table<int128_t>[1] == 10, "Wrong");
+}
+
+int main()
+{
+    test_unsigned();
+    test_signed();
+    test_pow10_table();
+    test_constexpr();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,150 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+
+static std::mt19937_64 rng{42};
+static constexpr std::size_t N{1024U};
+static std::uniform_int_distribution<std::uint64_t> dist{UINT64_C(0), UINT64_MAX};
+static std::uniform_int_distribution<std::uint32_t> dist32{UINT32_C(0), UINT32_MAX};
+
+using boost::int128::uint128_t;
+
+// Reference implementation using 32-bit words
+uint128_t knuth_reference(const uint128_t lhs, const uint128_t rhs, uint128_t& remainder)
+{
+    using namespace boost::int128::detail;
+
+    std::uint32_t u[4] {};
+    std::uint32_t v[4] {};
+    std::uint32_t q[4] {};
+
+    if (lhs < rhs)
+    {
+        remainder = lhs;
+        return uint128_t{0};
+    }
+
+    const auto m {impl::to_words(lhs, u)};
+    const auto n {impl::to_words(rhs, v)};
+
+    if (n == 1U)
+    {
+        uint128_t quotient {};
+        half_word_div(lhs, v[0], quotient, remainder);
+        return quotient;
+    }
+
+    impl::knuth_divide<true>(u, m, v, n, q);
+
+    remainder = impl::from_words<uint128_t>(u);
+    return impl::from_words<uint128_t>(q);
+}
+
+void test_reciprocal_word()
+{
+    using namespace boost::int128::detail;
+
+    const std::uint64_t edge_values[] {
+        UINT64_C(0x8000000000000000), UINT64_C(0x8000000000000001), UINT64_C(0xC000000000000000),
+        UINT64_MAX, UINT64_MAX - 1U, UINT64_C(0xFFFFFFFF00000000)
+    };
+
+    for (const auto d : edge_values)
+    {
+        uint128_t remainder {};
+        const auto expected {knuth_div_wide(uint128_t{0}, (std::numeric_limits<uint128_t>::max)(), uint128_t{d}, remainder)};
+        BOOST_TEST_EQ(impl::reciprocal_word(d), (expected - uint128_t{1, 0}).low);
+    }
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto d {dist(rng) | UINT64_C(0x8000000000000000)};
+
+        uint128_t remainder {};
+        const auto expected {knuth_div_wide(uint128_t{0}, (std::numeric_limits<uint128_t>::max)(), uint128_t{d}, remainder)};
+        BOOST_TEST_EQ(impl::reciprocal_word(d), (expected - uint128_t{1, 0}).low);
+    }
+}
+
+void test_one_limb()
+{
+    using namespace boost::int128::detail;
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const uint128_t lhs {dist(rng), dist(rng)};
+        const auto shift {static_cast<int>(i % 32U)};
+        const auto rhs {((dist(rng) | UINT64_C(0x8000000000000000)) >> shift) | (UINT64_C(1) << 32U)};
+
+        std::uint64_t remainder {};
+        const auto quotient {impl::mg_div_one_limb(lhs, rhs, remainder)};
+
+        uint128_t knuth_remainder {};
+        const auto knuth_quotient {knuth_reference(lhs, uint128_t{rhs}, knuth_remainder)};
+
+        BOOST_TEST_EQ(quotient, knuth_quotient);
+        BOOST_TEST_EQ(remainder, knuth_remainder);
+    }
+
+    {
+        constexpr auto lhs {(std::numeric_limits<uint128_t>::max)()};
+
+        std::uint64_t remainder {};
+        BOOST_TEST_EQ(impl::mg_div_one_limb(lhs, UINT64_MAX, remainder), (uint128_t{1, 1}));
+        BOOST_TEST_EQ(remainder, 0U);
+    }
+}
+
+void test_dispatch()
+{
+    // Dividend and divisor sizes that select each of the kernels through the operators
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const uint128_t lhs {dist(rng), dist(rng)};
+        const uint128_t rhs_two_limbs {dist32(rng) + 1U, dist(rng)};
+        const uint128_t rhs_one_limb {dist(rng) | (UINT64_C(1) << 40U)};
+
+        uint128_t remainder {};
+        auto quotient {knuth_reference(lhs, rhs_two_limbs, remainder)};
+        BOOST_TEST_EQ(lhs / rhs_two_limbs, quotient);
+        BOOST_TEST_EQ(lhs % rhs_two_limbs, remainder);
+
+        quotient = knuth_reference(lhs, rhs_one_limb, remainder);
+        BOOST_TEST_EQ(lhs / rhs_one_limb, quotient);
+        BOOST_TEST_EQ(lhs % rhs_one_limb, remainder);
+    }
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    using namespace boost::int128::detail;
+
+    constexpr uint128_t lhs {UINT64_C(0x123456789ABCDEF0), UINT64_C(0x0FEDCBA987654321)};
+    constexpr uint128_t rhs {UINT64_C(0x1234), UINT64_C(0x5678)};
+
+    constexpr auto quotient {knuth_div(lhs, rhs)};
+    static_assert(quotient * rhs <= lhs, "Wrong");
+    static_assert(lhs - quotient * rhs < rhs, "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_reciprocal_word();
+    test_one_limb();
+    test_dispatch();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
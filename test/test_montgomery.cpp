@@ -0,0 +1,101 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "random_u128.hpp"
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+constexpr std::size_t N = 256;
+
+void test_modulus(const uint128_t m)
+{
+    const montgomery_context<uint128_t> ctx {m};
+    BOOST_TEST_EQ(ctx.modulus(), m);
+    BOOST_TEST_EQ(ctx.from_mont(ctx.one()), 1U);
+
+    const uint128_t edge_values[] {uint128_t{0}, uint128_t{1}, uint128_t{2}, m - 1U, m, m + 1U,
+                                   (std::numeric_limits<uint128_t>::max)()};
+
+    for (const auto a : edge_values)
+    {
+        BOOST_TEST_EQ(ctx.from_mont(ctx.to_mont(a)), a % m);
+    }
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto a {random_u128(128) % m};
+        const auto b {(i & 1U) ? random_u128(static_cast<int>(rng() % 128U) + 1) % m : m - 1U - (random_u128(8) % m)};
+
+        const auto mont_a {ctx.to_mont(a)};
+        const auto mont_b {ctx.to_mont(b)};
+        BOOST_TEST(mont_a < m);
+        BOOST_TEST_EQ(ctx.from_mont(mont_a), a);
+
+        BOOST_TEST_EQ(ctx.from_mont(ctx.mul(mont_a, mont_b)), reference_mulmod(a, b, m));
+        BOOST_TEST_EQ(ctx.from_mont(ctx.sqr(mont_a)), reference_mulmod(a, a, m));
+
+        const auto sum {ctx.from_mont(ctx.add(mont_a, mont_b))};
+        BOOST_TEST_EQ(sum, b >= m - a ? b - (m - a) : a + b);
+
+        const auto difference {ctx.from_mont(ctx.sub(mont_a, mont_b))};
+        BOOST_TEST_EQ(difference, a >= b ? a - b : m - (b - a));
+    }
+}
+
+void test_moduli()
+{
+    const uint128_t edge_moduli[] {
+        uint128_t{3}, uint128_t{5}, uint128_t{1000000007}, uint128_t{UINT64_MAX},
+        uint128_t{UINT64_C(0xFFFFFFFFFFFFFFC5)}, uint128_t{1, 1},
+        (uint128_t{1} << 127) - 1U, (uint128_t{1} << 127) + 1U,
+        (std::numeric_limits<uint128_t>::max)(), (std::numeric_limits<uint128_t>::max)() - 158U
+    };
+
+    for (const auto m : edge_moduli)
+    {
+        test_modulus(m);
+    }
+
+    for (const int bits : {16, 64, 100, 127, 128})
+    {
+        for (std::size_t i {}; i < 8U; ++i)
+        {
+            auto m {random_u128(bits) | 1U};
+            if (m == 1U)
+            {
+                m = 3U;
+            }
+
+            test_modulus(m);
+        }
+    }
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    constexpr montgomery_context<uint128_t> ctx {uint128_t{1000000007}};
+    static_assert(ctx.from_mont(ctx.mul(ctx.to_mont(uint128_t{123456789}), ctx.to_mont(uint128_t{987654321}))) == 259106859U, "Wrong");
+    static_assert(ctx.from_mont(ctx.add(ctx.to_mont(uint128_t{1000000006}), ctx.to_mont(uint128_t{2}))) == 1U, "Wrong");
+    static_assert(ctx.from_mont(ctx.sub(ctx.to_mont(uint128_t{1}), ctx.to_mont(uint128_t{2}))) == 1000000006U, "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_moduli();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,141 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "random_u128.hpp"
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+constexpr std::size_t N = 1024;
+
+// Schoolbook multiplication on 32-bit words as an independent reference
+void reference_mul(const uint128_t lhs, const uint128_t rhs, uint128_t& high, uint128_t& low)
+{
+    const std::uint32_t a[4] {static_cast<std::uint32_t>(lhs.low), static_cast<std::uint32_t>(lhs.low >> 32U),
+                              static_cast<std::uint32_t>(lhs.high), static_cast<std::uint32_t>(lhs.high >> 32U)};
+    const std::uint32_t b[4] {static_cast<std::uint32_t>(rhs.low), static_cast<std::uint32_t>(rhs.low >> 32U),
+                              static_cast<std::uint32_t>(rhs.high), static_cast<std::uint32_t>(rhs.high >> 32U)};
+    std::uint32_t r[8] {};
+
+    for (std::size_t i {}; i < 4U; ++i)
+    {
+        std::uint64_t carry {};
+        for (std::size_t j {}; j < 4U; ++j)
+        {
+            const auto t {static_cast<std::uint64_t>(a[i]) * b[j] + r[i + j] + carry};
+            r[i + j] = static_cast<std::uint32_t>(t);
+            carry = t >> 32U;
+        }
+        r[i + 4U] = static_cast<std::uint32_t>(carry);
+    }
+
+    const auto word = [&r](const std::size_t i) { return static_cast<std::uint64_t>(r[i]) | (static_cast<std::uint64_t>(r[i + 1U]) << 32U); };
+
+    low = uint128_t{word(2U), word(0U)};
+    high = uint128_t{word(6U), word(4U)};
+}
+
+void test_unsigned()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto lhs {random_u128(static_cast<int>(rng() % 128U) + 1)};
+        const auto rhs {random_u128(static_cast<int>(rng() % 128U) + 1)};
+
+        uint128_t high {};
+        uint128_t low {};
+        reference_mul(lhs, rhs, high, low);
+
+        const auto product {mul_wide(lhs, rhs)};
+        BOOST_TEST_EQ(product.hi, high);
+        BOOST_TEST_EQ(product.lo, low);
+        BOOST_TEST_EQ(product.lo, lhs * rhs);
+        BOOST_TEST_EQ(mulhi(lhs, rhs), high);
+    }
+
+    constexpr auto max_value {(std::numeric_limits<uint128_t>::max)()};
+
+    // (2^128 - 1)^2 == 2^256 - 2^129 + 1
+    const auto product {mul_wide(max_value, max_value)};
+    BOOST_TEST_EQ(product.hi, max_value - 1U);
+    BOOST_TEST_EQ(product.lo, 1U);
+
+    BOOST_TEST_EQ(mulhi(max_value, uint128_t{1}), 0U);
+    BOOST_TEST_EQ(mulhi(uint128_t{1} << 127, uint128_t{2}), 1U);
+    BOOST_TEST_EQ(mulhi(uint128_t{1, 0}, uint128_t{1, 0}), 1U);
+}
+
+void test_signed()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto lhs {static_cast<int128_t>(random_u128(128))};
+        const auto rhs {static_cast<int128_t>(random_u128(static_cast<int>(rng() % 128U) + 1))};
+
+        // Signed product from the magnitudes, negating the 256-bit value if the signs differ
+        uint128_t high {};
+        uint128_t low {};
+        reference_mul(static_cast<uint128_t>(abs(lhs)), static_cast<uint128_t>(abs(rhs)), high, low);
+
+        if ((lhs < 0) != (rhs < 0))
+        {
+            high = ~high;
+            low = ~low;
+            ++low;
+            if (low == 0U)
+            {
+                ++high;
+            }
+        }
+
+        const auto product {mul_wide(lhs, rhs)};
+        BOOST_TEST_EQ(product.hi, static_cast<int128_t>(high));
+        BOOST_TEST_EQ(product.lo, low);
+        BOOST_TEST_EQ(mulhi(lhs, rhs), static_cast<int128_t>(high));
+    }
+
+    constexpr auto min_value {(std::numeric_limits<int128_t>::min)()};
+    constexpr auto max_value {(std::numeric_limits<int128_t>::max)()};
+
+    // (-2^127)^2 == 2^254
+    BOOST_TEST_EQ(mul_wide(min_value, min_value).hi, int128_t{1} << 126);
+    BOOST_TEST_EQ(mul_wide(min_value, min_value).lo, 0U);
+
+    // -2^127 * (2^127 - 1) == -2^254 + 2^127
+    BOOST_TEST_EQ(mul_wide(min_value, max_value).hi, -(int128_t{1} << 126));
+    BOOST_TEST_EQ(mul_wide(min_value, max_value).lo, uint128_t{1} << 127);
+
+    BOOST_TEST_EQ(mulhi(int128_t{-1}, int128_t{1}), -1);
+    BOOST_TEST_EQ(mulhi(int128_t{-1}, int128_t{-1}), 0);
+    BOOST_TEST_EQ(mul_wide(int128_t{-1}, int128_t{-1}).lo, 1U);
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    static_assert(mulhi(uint128_t{1, 0}, uint128_t{1, 0}) == 1U, "Wrong");
+    static_assert(mul_wide(uint128_t{3}, uint128_t{5}).lo == 15U, "Wrong");
+    static_assert(mul_wide(uint128_t{3}, uint128_t{5}).hi == 0U, "Wrong");
+    static_assert(mulhi(int128_t{-2}, int128_t{1, 0}) == -1, "Wrong");
+    static_assert(mul_wide(int128_t{-3}, int128_t{5}).hi == -1, "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_unsigned();
+    test_signed();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
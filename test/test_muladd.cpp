@@ -0,0 +1,127 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <vector>
+#include <cstdint>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng(42);
+
+constexpr std::size_t N = 1024;
+
+std::int64_t random_i64()
+{
+    // Mix full width values with small ones so that every sign combination and carry is hit
+    const auto value {static_cast<std::int64_t>(rng())};
+    return (rng() & 1U) ? value : value >> static_cast<int>(rng() % 64U);
+}
+
+void test_muladd()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto a {rng()};
+        const auto b {rng()};
+        const uint128_t c {rng(), rng()};
+
+        BOOST_TEST_EQ(muladd(a, b, c), uint128_t{a} * uint128_t{b} + c);
+
+        const auto sa {random_i64()};
+        const auto sb {random_i64()};
+        const auto sc {static_cast<int128_t>(uint128_t{rng(), rng()}) >> static_cast<int>(rng() % 128U)};
+
+        BOOST_TEST_EQ(muladd(sa, sb, sc), int128_t{sa} * int128_t{sb} + sc);
+    }
+
+    constexpr auto i64_min {(std::numeric_limits<std::int64_t>::min)()};
+    constexpr auto i64_max {(std::numeric_limits<std::int64_t>::max)()};
+
+    BOOST_TEST_EQ(muladd(UINT64_MAX, UINT64_MAX, uint128_t{0}), (uint128_t{UINT64_MAX - 1U, 1U}));
+    BOOST_TEST_EQ(muladd(UINT64_MAX, UINT64_MAX, uint128_t{UINT64_MAX} << 1), (std::numeric_limits<uint128_t>::max)());
+    BOOST_TEST_EQ(muladd(i64_min, i64_min, int128_t{0}), int128_t{1} << 126);
+    BOOST_TEST_EQ(muladd(i64_min, i64_max, int128_t{-1}), -(int128_t{1} << 126) + (int128_t{1} << 63) - 1);
+    BOOST_TEST_EQ(muladd(std::int64_t{-1}, std::int64_t{1}, int128_t{1}), 0);
+}
+
+void test_dot_product()
+{
+    for (const std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{4}, std::size_t{7}, std::size_t{64}, std::size_t{1001}})
+    {
+        std::vector<std::uint64_t> ua(n);
+        std::vector<std::uint64_t> ub(n);
+        std::vector<std::int64_t> sa(n);
+        std::vector<std::int64_t> sb(n);
+
+        uint128_t unsigned_expected {};
+        int128_t signed_expected {};
+
+        for (std::size_t i {}; i < n; ++i)
+        {
+            ua[i] = rng();
+            ub[i] = rng();
+            sa[i] = random_i64();
+            sb[i] = random_i64();
+
+            unsigned_expected += uint128_t{ua[i]} * uint128_t{ub[i]};
+            signed_expected += int128_t{sa[i]} * int128_t{sb[i]};
+        }
+
+        BOOST_TEST_EQ(dot_product(ua.data(), ub.data(), n), unsigned_expected);
+        BOOST_TEST_EQ(dot_product(sa.data(), sb.data(), n), signed_expected);
+    }
+
+    // Every product carries out of the low word
+    {
+        const std::vector<std::uint64_t> values(100, UINT64_MAX);
+        uint128_t expected {};
+        for (std::size_t i {}; i < values.size(); ++i)
+        {
+            expected += uint128_t{UINT64_MAX} * UINT64_MAX;
+        }
+
+        BOOST_TEST_EQ(dot_product(values.data(), values.data(), values.size()), expected);
+    }
+
+    // Products that cancel
+    {
+        const std::int64_t lhs[] {INT64_MIN, INT64_MIN, INT64_MAX, -INT64_MAX, 3, -3};
+        const std::int64_t rhs[] {INT64_MIN, INT64_MAX, INT64_MAX, INT64_MAX, -5, -5};
+
+        const auto expected {int128_t{INT64_MIN} * INT64_MIN + int128_t{INT64_MIN} * INT64_MAX};
+        BOOST_TEST_EQ(dot_product(lhs, rhs, 6U), expected);
+    }
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    constexpr std::int64_t lhs[] {1, -2, 3, -4, 5};
+    constexpr std::int64_t rhs[] {-6, 7, -8, 9, -10};
+    constexpr std::uint64_t ulhs[] {UINT64_MAX, 2U};
+
+    static_assert(dot_product(lhs, rhs, 5U) == -130, "Wrong");
+    static_assert(dot_product(ulhs, ulhs, 2U) == uint128_t{UINT64_MAX - 1U, 5U}, "Wrong");
+    static_assert(muladd(INT64_C(-3), INT64_C(5), int128_t{2}) == -13, "Wrong");
+    static_assert(muladd(UINT64_C(3), UINT64_C(5), uint128_t{1, 0}) == uint128_t{1, 15}, "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_muladd();
+    test_dot_product();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,218 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <functional>
+#include <cstdint>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng {42};
+
+constexpr std::size_t N {1024};
+
+using parser = std::function<parse_column_result(const std::string&, char, uint128_t*)>;
+
+// The public function and every kernel this processor can run
+std::vector<parser> parsers()
+{
+    std::vector<parser> result;
+
+    result.emplace_back([](const std::string& text, const char delim, uint128_t* out) {
+        return parse_column(text.data(), text.size(), delim, out);
+    });
+    result.emplace_back([](const std::string& text, const char delim, uint128_t* out) {
+        return detail::parse_column_scalar(text.data(), text.data() + text.size(), delim, out, 0U);
+    });
+
+    #ifdef BOOST_INT128_HAS_X86_DISPATCH
+
+    const auto level {detail::cpu_simd_level()};
+    if (level != detail::simd_level::scalar)
+    {
+        result.emplace_back([](const std::string& text, const char delim, uint128_t* out) {
+            return detail::parse_column_sse41(text.data(), text.data() + text.size(), delim, out);
+        });
+    }
+    if (level == detail::simd_level::avx2)
+    {
+        result.emplace_back([](const std::string& text, const char delim, uint128_t* out) {
+            return detail::parse_column_avx2(text.data(), text.data() + text.size(), delim, out);
+        });
+    }
+
+    #endif
+
+    return result;
+}
+
+std::string format(const uint128_t value)
+{
+    char buffer[64] {};
+    const auto r {to_chars(buffer, buffer + sizeof(buffer), value)};
+    return std::string(buffer, r.ptr);
+}
+
+// Every length from 1 to 39 digits is common
+uint128_t random_value()
+{
+    return uint128_t{rng(), rng()} >> static_cast<int>(rng() % 128U);
+}
+
+std::string join(const std::vector<uint128_t>& values, const char delim, const bool trailing)
+{
+    std::string text;
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        text += format(values[i]);
+        if (trailing || i + 1U < values.size())
+        {
+            text.push_back(delim);
+        }
+    }
+
+    return text;
+}
+
+void test_values()
+{
+    for (const auto& parse : parsers())
+    {
+        for (const auto delim : {',', '\n', '\t', ' '})
+        {
+            for (const auto trailing : {false, true})
+            {
+                for (const auto size : {std::size_t{0}, std::size_t{1}, std::size_t{3}, N})
+                {
+                    std::vector<uint128_t> values;
+                    for (std::size_t i {}; i < size; ++i)
+                    {
+                        values.push_back(random_value());
+                    }
+
+                    const auto text {join(values, delim, trailing)};
+                    std::vector<uint128_t> out(size + 1U);
+                    const auto r {parse(text, delim, out.data())};
+
+                    BOOST_TEST(r.ec == std::errc{});
+                    BOOST_TEST(static_cast<bool>(r));
+                    BOOST_TEST(r.ptr == text.data() + text.size());
+                    BOOST_TEST_EQ(r.count, size);
+
+                    for (std::size_t i {}; i < size && i < r.count; ++i)
+                    {
+                        BOOST_TEST_EQ(out[i], values[i]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void test_boundaries()
+{
+    // The largest value, leading zeros, and every power of ten with its neighbours
+    std::vector<std::string> fields {"340282366920938463463374607431768211455", "0", "00000000000000000000000000000000000000000000000042"};
+    std::vector<uint128_t> expected {(std::numeric_limits<uint128_t>::max)(), 0U, 42U};
+
+    uint128_t power {1};
+    for (int i {}; i < 39; ++i)
+    {
+        for (const auto value : {power - 1U, power, power + 1U})
+        {
+            fields.push_back(format(value));
+            expected.push_back(value);
+        }
+
+        fields.push_back(std::string(static_cast<std::size_t>(i), '0') + format(power));
+        expected.push_back(power);
+
+        power *= 10U;
+    }
+
+    std::string text;
+    for (const auto& field : fields)
+    {
+        text += field + ',';
+    }
+
+    for (const auto& parse : parsers())
+    {
+        std::vector<uint128_t> out(expected.size());
+        const auto r {parse(text, ',', out.data())};
+
+        BOOST_TEST(r == (parse_column_result{text.data() + text.size(), expected.size(), std::errc{}}));
+        BOOST_TEST(out == expected);
+    }
+}
+
+// Puts a bad field after enough good ones that the vector kernels reach it
+void check_error(const std::string& bad_field, const std::errc ec)
+{
+    std::vector<uint128_t> values;
+    for (std::size_t i {}; i < 64U; ++i)
+    {
+        values.push_back(random_value());
+    }
+
+    const auto good {join(values, ',', true)};
+    const auto text {good + bad_field + "," + join(values, ',', false)};
+
+    for (const auto& parse : parsers())
+    {
+        std::vector<uint128_t> out(2U * values.size() + 1U);
+        const auto r {parse(text, ',', out.data())};
+
+        BOOST_TEST(r.ec == ec);
+        BOOST_TEST(!r);
+        BOOST_TEST(r.ptr == text.data() + good.size());
+        BOOST_TEST_EQ(r.count, values.size());
+
+        for (std::size_t i {}; i < values.size(); ++i)
+        {
+            BOOST_TEST_EQ(out[i], values[i]);
+        }
+    }
+}
+
+void test_errors()
+{
+    check_error("", std::errc::invalid_argument);
+    check_error("12a3", std::errc::invalid_argument);
+    check_error("-1", std::errc::invalid_argument);
+    check_error("+1", std::errc::invalid_argument);
+    check_error("12;34", std::errc::invalid_argument);
+    check_error("340282366920938463463374607431768211456", std::errc::result_out_of_range);
+    check_error("999999999999999999999999999999999999999", std::errc::result_out_of_range);
+    check_error("3402823669209384634633746074317682114550", std::errc::result_out_of_range);
+
+    // Errors in the last few fields, where only the scalar loop runs
+    for (const auto& parse : parsers())
+    {
+        const std::string text {"1,2,,3"};
+        uint128_t out[4] {};
+        BOOST_TEST(parse(text, ',', out) == (parse_column_result{text.data() + 4, 2U, std::errc::invalid_argument}));
+
+        const std::string overflow {"1,340282366920938463463374607431768211456"};
+        BOOST_TEST(parse(overflow, ',', out) == (parse_column_result{overflow.data() + 2, 1U, std::errc::result_out_of_range}));
+
+        const std::string only_delimiter {","};
+        BOOST_TEST(parse(only_delimiter, ',', out) == (parse_column_result{only_delimiter.data(), 0U, std::errc::invalid_argument}));
+    }
+}
+
+int main()
+{
+    test_values();
+    test_boundaries();
+    test_errors();
+
+    return boost::report_errors();
+}
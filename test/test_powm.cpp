@@ -0,0 +1,151 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "random_u128.hpp"
+#include <random>
+#include <limits>
+#include <vector>
+#include <cstdint>
+
+using namespace boost::int128;
+
+constexpr std::size_t N = 64;
+
+// Right-to-left binary exponentiation with long division
+uint128_t reference_powm(uint128_t base, uint128_t exp, const uint128_t m)
+{
+    if (m <= 1U)
+    {
+        return uint128_t{0};
+    }
+
+    uint128_t result {1};
+    base %= m;
+
+    while (exp != 0U)
+    {
+        if ((exp.low & 1U) == 1U)
+        {
+            result = reference_mulmod(result, base, m);
+        }
+
+        base = reference_mulmod(base, base, m);
+        exp >>= 1U;
+    }
+
+    return result;
+}
+
+void test_modulus(const uint128_t m)
+{
+    constexpr auto max_value {(std::numeric_limits<uint128_t>::max)()};
+    const uint128_t edge_values[] {uint128_t{0}, uint128_t{1}, uint128_t{2}, m - 1U, m, m + 1U, max_value};
+
+    for (const auto base : edge_values)
+    {
+        for (const auto exp : edge_values)
+        {
+            BOOST_TEST_EQ(powm(base, exp, m), reference_powm(base, exp, m));
+        }
+    }
+
+    std::vector<uint128_t> bases(N + 3U);
+    std::vector<uint128_t> exps(N + 3U);
+    for (std::size_t i {}; i < bases.size(); ++i)
+    {
+        bases[i] = random_u128(static_cast<int>(rng() % 128U) + 1);
+
+        // Exercise every window width
+        exps[i] = random_u128(static_cast<int>(i % 128U) + 1);
+
+        BOOST_TEST_EQ(powm(bases[i], exps[i], m), reference_powm(bases[i], exps[i], m));
+    }
+
+    // The sizes are not a multiple of the interleaving width to exercise the tail
+    std::vector<uint128_t> out(bases.size());
+
+    powm_n(bases.data(), exps.data(), bases.size(), m, out.data());
+    for (std::size_t i {}; i < bases.size(); ++i)
+    {
+        BOOST_TEST_EQ(out[i], reference_powm(bases[i], exps[i], m));
+    }
+
+    for (const int bits : {1, 8, 20, 64, 128})
+    {
+        const auto exp {random_u128(bits)};
+
+        powm_n(bases.data(), bases.size(), exp, m, out.data());
+        for (std::size_t i {}; i < bases.size(); ++i)
+        {
+            BOOST_TEST_EQ(out[i], reference_powm(bases[i], exp, m));
+        }
+    }
+}
+
+void test_moduli()
+{
+    const uint128_t edge_moduli[] {
+        uint128_t{0}, uint128_t{1}, uint128_t{2}, uint128_t{3}, uint128_t{10}, uint128_t{1000000007},
+        uint128_t{UINT64_C(0x8000000000000000)}, uint128_t{UINT64_MAX}, uint128_t{1, 0}, uint128_t{1, 1},
+        uint128_t{1} << 127, (uint128_t{1} << 127) - 1U, (uint128_t{1} << 127) + 1U,
+        (std::numeric_limits<uint128_t>::max)(), (std::numeric_limits<uint128_t>::max)() - 1U
+    };
+
+    for (const auto m : edge_moduli)
+    {
+        test_modulus(m);
+    }
+
+    for (const int bits : {16, 63, 64, 100, 128})
+    {
+        for (std::size_t i {}; i < 4U; ++i)
+        {
+            // Odd and even moduli of each width
+            test_modulus(random_u128(bits) | 1U);
+            test_modulus(random_u128(bits) & ~uint128_t{1});
+        }
+    }
+}
+
+void test_known_values()
+{
+    // Fermat's little theorem for the Mersenne prime 2^127 - 1
+    const auto p {(uint128_t{1} << 127) - 1U};
+    BOOST_TEST_EQ(powm(uint128_t{3}, p - 1U, p), 1U);
+    BOOST_TEST_EQ(powm(uint128_t{2}, uint128_t{127}, p), 1U);
+
+    // 2^64 + 13 is prime
+    const uint128_t q {1, 13};
+    BOOST_TEST_EQ(powm(uint128_t{UINT64_C(0x123456789)}, q - 1U, q), 1U);
+
+    BOOST_TEST_EQ(powm(uint128_t{2}, uint128_t{100}, uint128_t{1} << 101), uint128_t{1} << 100);
+    BOOST_TEST_EQ(powm(uint128_t{2}, uint128_t{200}, uint128_t{1} << 101), 0U);
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    static_assert(powm(uint128_t{3}, uint128_t{200}, uint128_t{1000000007}) == 136318165U, "Wrong");
+    static_assert(powm(uint128_t{3}, uint128_t{1000}, uint128_t{1, 1}) == UINT64_C(0x44DEC82532D655B6), "Wrong");
+    static_assert(powm(uint128_t{3}, uint128_t{1000}, uint128_t{1, 2}) == powm(uint128_t{9}, uint128_t{500}, uint128_t{1, 2}), "Wrong");
+    static_assert(powm(uint128_t{7}, uint128_t{0}, uint128_t{10}) == 1U, "Wrong");
+    static_assert(powm(uint128_t{7}, uint128_t{5}, uint128_t{0}) == 0U, "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_moduli();
+    test_known_values();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
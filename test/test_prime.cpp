@@ -0,0 +1,283 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/prime.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng {42};
+
+// Deterministic Miller-Rabin for n < 2^64 with the first 12 prime bases,
+// using plain 128-bit products and remainders
+bool reference_is_prime(const std::uint64_t n)
+{
+    if (n < 2U)
+    {
+        return false;
+    }
+
+    constexpr std::uint64_t bases[] {2U, 3U, 5U, 7U, 11U, 13U, 17U, 19U, 23U, 29U, 31U, 37U};
+    for (const auto p : bases)
+    {
+        if (n % p == 0U)
+        {
+            return n == p;
+        }
+    }
+
+    auto d {n - 1U};
+    int s {};
+    while ((d & 1U) == 0U)
+    {
+        d >>= 1U;
+        ++s;
+    }
+
+    const auto mulmod = [n](const std::uint64_t x, const std::uint64_t y) { return static_cast<std::uint64_t>(uint128_t{x} * y % n); };
+
+    for (const auto a : bases)
+    {
+        std::uint64_t x {1};
+        std::uint64_t base {a};
+        for (auto e {d}; e != 0U; e >>= 1U)
+        {
+            if (e & 1U)
+            {
+                x = mulmod(x, base);
+            }
+            base = mulmod(base, base);
+        }
+
+        if (x == 1U || x == n - 1U)
+        {
+            continue;
+        }
+
+        bool witness {true};
+        for (int i {1}; i < s && witness; ++i)
+        {
+            x = mulmod(x, x);
+            witness = x != n - 1U;
+        }
+
+        if (witness)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void test_small()
+{
+    constexpr std::size_t limit {100000U};
+
+    std::vector<bool> sieve(limit, true);
+    sieve[0] = false;
+    sieve[1] = false;
+    for (std::size_t i {2}; i * i < limit; ++i)
+    {
+        if (sieve[i])
+        {
+            for (auto j {i * i}; j < limit; j += i)
+            {
+                sieve[j] = false;
+            }
+        }
+    }
+
+    for (std::size_t i {}; i < limit; ++i)
+    {
+        BOOST_TEST_EQ(is_prime(uint128_t{i}), sieve[i]);
+    }
+}
+
+void test_known_values()
+{
+    // Mersenne primes and the largest primes below 2^64 and 2^128
+    BOOST_TEST(is_prime((uint128_t{1} << 61) - 1U));
+    BOOST_TEST(is_prime((uint128_t{1} << 89) - 1U));
+    BOOST_TEST(is_prime((uint128_t{1} << 107) - 1U));
+    BOOST_TEST(is_prime((uint128_t{1} << 127) - 1U));
+    BOOST_TEST(is_prime(uint128_t{UINT64_MAX - 58U}));
+    BOOST_TEST(is_prime((std::numeric_limits<uint128_t>::max)() - 158U));
+
+    // The smallest primes above some powers of two
+    BOOST_TEST(is_prime((uint128_t{1} << 64) + 13U));
+    BOOST_TEST(is_prime((uint128_t{1} << 96) + 61U));
+    BOOST_TEST(is_prime((uint128_t{1} << 112) + 25U));
+    BOOST_TEST(is_prime((uint128_t{1} << 126) + 7U));
+    BOOST_TEST(!is_prime((uint128_t{1} << 126) + 1U));
+    BOOST_TEST(!is_prime((uint128_t{1} << 126) + 3U));
+
+    BOOST_TEST(!is_prime((std::numeric_limits<uint128_t>::max)()));
+    BOOST_TEST(!is_prime((uint128_t{1} << 127) - 3U));
+
+    // Strong pseudoprimes to base 2, including the squares of the Wieferich primes
+    BOOST_TEST(!is_prime(uint128_t{2047U}));
+    BOOST_TEST(!is_prime(uint128_t{3215031751U}));
+    BOOST_TEST(!is_prime(uint128_t{1093U * 1093U}));
+    BOOST_TEST(!is_prime(uint128_t{3511U * 3511U}));
+
+    // Strong pseudoprime to every prime base up to 23, and up to 37
+    BOOST_TEST(!is_prime(uint128_t{UINT64_C(3825123056546413051)}));
+    BOOST_TEST(!is_prime(uint128_t{UINT64_C(17274), UINT64_C(0xE92817F9FC85B7E5)}));
+
+    // Strong Lucas pseudoprimes with the parameters of Selfridge
+    for (const auto n : {5459U, 5777U, 10877U, 16109U, 18971U, 22499U, 24569U, 25199U, 40309U, 58519U})
+    {
+        BOOST_TEST(!is_prime(uint128_t{n}));
+    }
+
+    // Squares and products of large primes
+    const auto p61 {(uint128_t{1} << 61) - 1U};
+    const auto p64 {(uint128_t{1} << 64) + 13U};
+    BOOST_TEST(!is_prime(p61 * p61));
+    BOOST_TEST(!is_prime(p61 * p64));
+    BOOST_TEST(!is_prime(uint128_t{UINT64_C(1073741831)} * UINT64_C(1073741831)));
+}
+
+void test_random_64()
+{
+    for (std::size_t i {}; i < 4096U; ++i)
+    {
+        const auto n {rng() >> (rng() % 64U)};
+        BOOST_TEST_EQ(is_prime(uint128_t{n}), reference_is_prime(n));
+    }
+
+    // Random primes are sparse, so also step through some runs of odd values
+    for (std::size_t i {}; i < 16U; ++i)
+    {
+        const auto start {rng() | 1U};
+        for (std::uint64_t n {start}; n < start + 512U; n += 2U)
+        {
+            BOOST_TEST_EQ(is_prime(uint128_t{n}), reference_is_prime(n));
+        }
+    }
+}
+
+// Multiplies out the factors and checks that they are ascending primes
+void check_factorization(const uint128_t n)
+{
+    const auto result {factorize(n)};
+
+    uint128_t product {1};
+    uint128_t previous {0};
+    for (const auto& factor : result)
+    {
+        BOOST_TEST(is_prime(factor.prime));
+        BOOST_TEST(factor.prime > previous);
+        BOOST_TEST(factor.multiplicity > 0);
+
+        for (int i {}; i < factor.multiplicity; ++i)
+        {
+            product *= factor.prime;
+        }
+
+        previous = factor.prime;
+    }
+
+    BOOST_TEST_EQ(product, n);
+}
+
+void test_factorize()
+{
+    BOOST_TEST_EQ(factorize(uint128_t{0}).size, 0U);
+    BOOST_TEST_EQ(factorize(uint128_t{1}).size, 0U);
+
+    const auto two {factorize(uint128_t{2})};
+    BOOST_TEST_EQ(two.size, 1U);
+    BOOST_TEST_EQ(two.factors[0].prime, 2U);
+    BOOST_TEST_EQ(two.factors[0].multiplicity, 1);
+
+    const auto power {factorize(uint128_t{1} << 127)};
+    BOOST_TEST_EQ(power.size, 1U);
+    BOOST_TEST_EQ(power.factors[0].prime, 2U);
+    BOOST_TEST_EQ(power.factors[0].multiplicity, 127);
+
+    // 2^128 - 1 = 3 * 5 * 17 * 257 * 641 * 65537 * 274177 * 6700417 * 67280421310721
+    const auto max {factorize((std::numeric_limits<uint128_t>::max)())};
+    const std::uint64_t expected[] {3U, 5U, 17U, 257U, 641U, 65537U, 274177U, 6700417U, UINT64_C(67280421310721)};
+    BOOST_TEST_EQ(max.size, 9U);
+    for (std::size_t i {}; i < max.size; ++i)
+    {
+        BOOST_TEST_EQ(max.factors[i].prime, expected[i]);
+        BOOST_TEST_EQ(max.factors[i].multiplicity, 1);
+    }
+
+    // The product of the first 26 primes has the largest possible number of distinct factors
+    uint128_t primorial {1};
+    for (std::uint64_t p {2}; p <= 101U; ++p)
+    {
+        if (is_prime(uint128_t{p}))
+        {
+            primorial *= p;
+        }
+    }
+    BOOST_TEST_EQ(factorize(primorial).size, 26U);
+    check_factorization(primorial);
+
+    // Two 40-bit primes, a squared 30-bit prime and large prime powers
+    const uint128_t p40 {UINT64_C(1099511640127)};
+    const uint128_t q41 {UINT64_C(2199023256557)};
+    const uint128_t r30 {UINT64_C(1073741831)};
+    check_factorization(p40 * q41);
+    check_factorization(r30 * r30 * p40);
+    check_factorization(r30 * r30 * r30 * r30);
+    check_factorization(uint128_t{1093U * 1093U} * 3511U * 3511U * 239U);
+
+    // The largest primes of the trial division table, on a value wider than a word
+    const auto largest_trial {factorize(uint128_t{239U * 239U} * 241U * 251U * 257U * ((uint128_t{1} << 61) - 1U))};
+    BOOST_TEST_EQ(largest_trial.size, 5U);
+    BOOST_TEST_EQ(largest_trial.factors[0].prime, 239U);
+    BOOST_TEST_EQ(largest_trial.factors[0].multiplicity, 2);
+    BOOST_TEST_EQ(largest_trial.factors[1].prime, 241U);
+    BOOST_TEST_EQ(largest_trial.factors[2].prime, 251U);
+    BOOST_TEST_EQ(largest_trial.factors[3].prime, 257U);
+    BOOST_TEST_EQ(largest_trial.factors[4].prime, (uint128_t{1} << 61) - 1U);
+
+    const auto mersenne {factorize(((uint128_t{1} << 61) - 1U) * 3U)};
+    BOOST_TEST_EQ(mersenne.size, 2U);
+    BOOST_TEST_EQ(mersenne.factors[1].prime, (uint128_t{1} << 61) - 1U);
+
+    // Random values whose prime factors are small enough for rho to be quick
+    for (std::size_t i {}; i < 32U; ++i)
+    {
+        check_factorization(uint128_t{rng()});
+        check_factorization(uint128_t{rng() >> 24U} * (rng() >> 24U) * (rng() >> 24U));
+    }
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    static_assert(is_prime(uint128_t{UINT64_C(1000000007)}), "Wrong");
+    static_assert(!is_prime(uint128_t{1093U * 1093U}), "Wrong");
+    static_assert(factorize(uint128_t{360U}).size == 3U, "Wrong");
+    static_assert(factorize(uint128_t{360U}).factors[0].multiplicity == 3, "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_small();
+    test_known_values();
+    test_random_64();
+    test_factorize();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,250 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng {42};
+
+// Computes r^n, reporting overflow past 2^128 - 1
+bool checked_power(const uint128_t r, const int n, uint128_t& result)
+{
+    result = uint128_t{1};
+    for (int i {}; i < n; ++i)
+    {
+        if (ckd_mul(&result, result, r))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// r is the floor of the nth root when r^n <= x < (r + 1)^n
+void check_root(const uint128_t x, const int n, const uint128_t r)
+{
+    uint128_t power {};
+    BOOST_TEST(checked_power(r, n, power));
+    BOOST_TEST(power <= x);
+
+    if (checked_power(r + 1U, n, power))
+    {
+        BOOST_TEST(power > x);
+    }
+}
+
+uint128_t random_value()
+{
+    return uint128_t{rng(), rng()} >> static_cast<int>(rng() % 128U);
+}
+
+void test_isqrt()
+{
+    BOOST_TEST_EQ(isqrt(uint128_t{0}), 0U);
+    BOOST_TEST_EQ(isqrt(uint128_t{1}), 1U);
+    BOOST_TEST_EQ(isqrt(uint128_t{3}), 1U);
+    BOOST_TEST_EQ(isqrt(uint128_t{4}), 2U);
+    BOOST_TEST_EQ(isqrt(uint128_t{UINT64_MAX}), UINT32_MAX);
+    BOOST_TEST_EQ(isqrt((std::numeric_limits<uint128_t>::max)()), UINT64_MAX);
+    BOOST_TEST_EQ(isqrt(uint128_t{1} << 64), UINT64_C(1) << 32);
+    BOOST_TEST_EQ(isqrt(uint128_t{1} << 127), UINT64_C(13043817825332782212));
+
+    // Squares and their neighbours, where rounding to double is most likely to be off by one
+    for (std::size_t i {}; i < 4096U; ++i)
+    {
+        const uint128_t r {rng() >> (rng() % 64U)};
+        const auto square {r * r};
+        BOOST_TEST_EQ(isqrt(square), r);
+        BOOST_TEST_EQ(isqrt(square + r + r), r);
+
+        if (r != 0U)
+        {
+            BOOST_TEST_EQ(isqrt(square - 1U), r - 1U);
+        }
+    }
+
+    for (std::size_t i {}; i < 4096U; ++i)
+    {
+        const auto x {random_value()};
+        check_root(x, 2, isqrt(x));
+    }
+}
+
+void test_icbrt()
+{
+    BOOST_TEST_EQ(icbrt(uint128_t{0}), 0U);
+    BOOST_TEST_EQ(icbrt(uint128_t{7}), 1U);
+    BOOST_TEST_EQ(icbrt(uint128_t{8}), 2U);
+    BOOST_TEST_EQ(icbrt((std::numeric_limits<uint128_t>::max)()), UINT64_C(6981463658331));
+
+    for (std::size_t i {}; i < 4096U; ++i)
+    {
+        const uint128_t r {rng() >> (22U + rng() % 42U)};
+        const auto cube {r * r * r};
+        BOOST_TEST_EQ(icbrt(cube), r);
+
+        if (r != 0U)
+        {
+            BOOST_TEST_EQ(icbrt(cube - 1U), r - 1U);
+        }
+
+        const auto x {random_value()};
+        check_root(x, 3, icbrt(x));
+    }
+}
+
+void test_iroot()
+{
+    const auto max {(std::numeric_limits<uint128_t>::max)()};
+
+    BOOST_TEST_EQ(iroot(max, 1), max);
+    BOOST_TEST_EQ(iroot(max, 2), UINT64_MAX);
+    BOOST_TEST_EQ(iroot(max, 4), UINT32_MAX);
+    BOOST_TEST_EQ(iroot(max, 127), 2U);
+    BOOST_TEST_EQ(iroot(max, 128), 1U);
+    BOOST_TEST_EQ(iroot(max, 1000), 1U);
+    BOOST_TEST_EQ(iroot(uint128_t{0}, 5), 0U);
+    BOOST_TEST_EQ(iroot(uint128_t{1} << 126, 63), 4U);
+    BOOST_TEST_EQ(iroot((uint128_t{1} << 126) - 1U, 63), 3U);
+
+    for (std::size_t i {}; i < 4096U; ++i)
+    {
+        const auto x {random_value()};
+        const auto n {static_cast<int>(1U + rng() % 130U)};
+        check_root(x, n, iroot(x, n));
+    }
+
+    // Exact powers and their predecessors for every degree
+    for (int n {4}; n < 128; ++n)
+    {
+        const uint128_t limit {iroot(max, n)};
+        for (std::size_t i {}; i < 16U; ++i)
+        {
+            const auto r {2U + uint128_t{rng()} % (limit - 1U)};
+            uint128_t power {};
+            BOOST_TEST(checked_power(r, n, power));
+            BOOST_TEST_EQ(iroot(power, n), r);
+            BOOST_TEST_EQ(iroot(power - 1U, n), r - 1U);
+        }
+    }
+}
+
+void test_is_perfect_square()
+{
+    BOOST_TEST(is_perfect_square(uint128_t{0}));
+    BOOST_TEST(is_perfect_square(uint128_t{1}));
+    BOOST_TEST(!is_perfect_square(uint128_t{2}));
+    BOOST_TEST(!is_perfect_square((std::numeric_limits<uint128_t>::max)()));
+    BOOST_TEST(is_perfect_square(uint128_t{UINT64_MAX} * UINT64_MAX));
+
+    for (std::uint64_t x {}; x < 100000U; ++x)
+    {
+        const auto r {isqrt(uint128_t{x})};
+        BOOST_TEST_EQ(is_perfect_square(uint128_t{x}), r * r == x);
+    }
+
+    for (std::size_t i {}; i < 4096U; ++i)
+    {
+        const uint128_t r {rng() >> (rng() % 64U)};
+        BOOST_TEST(is_perfect_square(r * r));
+
+        if (r > 1U)
+        {
+            BOOST_TEST(!is_perfect_square(r * r + 1U));
+            BOOST_TEST(!is_perfect_square(r * r - 1U));
+        }
+
+        const auto x {random_value()};
+        const auto root {isqrt(x)};
+        BOOST_TEST_EQ(is_perfect_square(x), root * root == x);
+    }
+}
+
+void test_is_perfect_power()
+{
+    BOOST_TEST(is_perfect_power(uint128_t{0}));
+    BOOST_TEST(is_perfect_power(uint128_t{1}));
+    BOOST_TEST(!is_perfect_power(uint128_t{2}));
+    BOOST_TEST(is_perfect_power(uint128_t{4}));
+    BOOST_TEST(is_perfect_power(uint128_t{8}));
+    BOOST_TEST(!is_perfect_power(uint128_t{12}));
+    BOOST_TEST(is_perfect_power(uint128_t{1} << 127));
+    BOOST_TEST(is_perfect_power(uint128_t{1} << 125));
+    BOOST_TEST(!is_perfect_power((uint128_t{1} << 127) - 1U));
+    BOOST_TEST(!is_perfect_power((std::numeric_limits<uint128_t>::max)()));
+
+    // Large odd powers and nearby values that are not powers
+    uint128_t power {};
+    BOOST_TEST(checked_power(3U, 80, power));
+    BOOST_TEST(is_perfect_power(power));
+    BOOST_TEST(!is_perfect_power(power + 2U));
+    BOOST_TEST(checked_power(7U, 45, power));
+    BOOST_TEST(is_perfect_power(power));
+    BOOST_TEST(!is_perfect_power(power * 2U));
+    BOOST_TEST(checked_power(12U, 35, power));
+    BOOST_TEST(is_perfect_power(power));
+    BOOST_TEST(!is_perfect_power(power * 2U));
+
+    // Compare against a search over every exponent for small values
+    for (std::uint64_t x {}; x < 20000U; ++x)
+    {
+        bool expected {x < 2U};
+        for (int k {2}; k < 16 && !expected; ++k)
+        {
+            const auto r {iroot(uint128_t{x}, k)};
+            uint128_t p {};
+            expected = checked_power(r, k, p) && p == x;
+        }
+
+        BOOST_TEST_EQ(is_perfect_power(uint128_t{x}), expected);
+    }
+
+    for (int n {2}; n < 128; ++n)
+    {
+        const auto limit {iroot((std::numeric_limits<uint128_t>::max)(), n)};
+        for (std::size_t i {}; i < 8U; ++i)
+        {
+            const auto r {2U + uint128_t{rng()} % (limit - 1U)};
+            BOOST_TEST(checked_power(r, n, power));
+            BOOST_TEST(is_perfect_power(power));
+        }
+    }
+}
+
+#ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+
+void test_constexpr()
+{
+    static_assert(isqrt((std::numeric_limits<uint128_t>::max)()) == UINT64_MAX, "Wrong");
+    static_assert(isqrt(uint128_t{1} << 64) == UINT64_C(1) << 32, "Wrong");
+    static_assert(icbrt(uint128_t{1000001}) == 100U, "Wrong");
+    static_assert(iroot(uint128_t{1} << 126, 63) == 4U, "Wrong");
+    static_assert(is_perfect_square(uint128_t{UINT64_MAX} * UINT64_MAX), "Wrong");
+    static_assert(!is_perfect_square(uint128_t{UINT64_MAX} * UINT64_MAX - 1U), "Wrong");
+    static_assert(is_perfect_power(uint128_t{1} << 125), "Wrong");
+    static_assert(!is_perfect_power(uint128_t{1} << 64 | 1U), "Wrong");
+}
+
+#endif
+
+int main()
+{
+    test_isqrt();
+    test_icbrt();
+    test_iroot();
+    test_is_perfect_square();
+    test_is_perfect_power();
+
+    #ifndef BOOST_INT128_NO_CONSTEVAL_DETECTION
+    test_constexpr();
+    #endif
+
+    return boost::report_errors();
+}
@@ -345,7 +345,8 @@ void test_mul_sat<boost::int128::int128_t>()
         boost::int128::int128_t y {2};
         int bit_count {4};
 
-        while (bit_count < 128)
+        // 2^63 * 2^63 == 2^126 still fits
+        while (bit_count <= 128)
         {
             const auto sat_res {mul_sat(x, y)};
             BOOST_TEST(sat_res < std::numeric_limits<boost::int128::int128_t>::max());
@@ -378,7 +379,8 @@ void test_mul_sat<boost::int128::int128_t>()
         boost::int128::int128_t y {-2};
         int bit_count {4};
 
-        while (bit_count < 128)
+        // 2^63 * 2^63 == 2^126 still fits
+        while (bit_count <= 128)
         {
             const auto sat_res {mul_sat(x, y)};
             BOOST_TEST(sat_res < std::numeric_limits<boost::int128::int128_t>::max());
@@ -12,6 +12,9 @@
 #include <iomanip>
 #include <sstream>
 #include <random>
+#include <string>
+#include <limits>
+#include <cstdint>
 
 #ifdef __clang__
 #  pragma clang diagnostic push
@@ -87,15 +90,20 @@ void test_ostream()
 
     T hex_val {0xFF};
     std::stringstream hex_out;
-    hex_out.flags(std::ios_base::hex);
+    hex_out.flags(std::ios_base::hex | std::ios_base::showbase);
     hex_out << hex_val;
     BOOST_TEST_CSTR_EQ(hex_out.str().c_str(), "0xff");
 
+    std::stringstream hex_out_no_base;
+    hex_out_no_base.flags(std::ios_base::hex);
+    hex_out_no_base << hex_val;
+    BOOST_TEST_CSTR_EQ(hex_out_no_base.str().c_str(), "ff");
+
     // 32-bit windows does not set the flags correctly in CI
     #ifndef _M_IX86
 
     std::stringstream hex_out_upper;
-    hex_out_upper.flags(std::ios_base::hex | std::ios_base::uppercase);
+    hex_out_upper.flags(std::ios_base::hex | std::ios_base::uppercase | std::ios_base::showbase);
     hex_out_upper << hex_val;
     BOOST_TEST_CSTR_EQ(hex_out_upper.str().c_str(), "0XFF");
 
@@ -103,10 +111,15 @@ void test_ostream()
 
     T octal_val {04};
     std::stringstream octal_out;
-    octal_out.flags(std::ios_base::oct);
+    octal_out.flags(std::ios_base::oct | std::ios_base::showbase);
     octal_out << octal_val;
     BOOST_TEST_CSTR_EQ(octal_out.str().c_str(), "04");
 
+    std::stringstream octal_out_no_base;
+    octal_out_no_base.flags(std::ios_base::oct);
+    octal_out_no_base << octal_val;
+    BOOST_TEST_CSTR_EQ(octal_out_no_base.str().c_str(), "4");
+
     BOOST_INT128_IF_CONSTEXPR (std::is_same<T, boost::int128::uint128_t>::value)
     {
         boost::int128::uint128_t max_val {std::numeric_limits<boost::int128::uint128_t>::max()};
@@ -277,6 +290,181 @@ void test_round_trip<boost::int128::int128_t>()
     BOOST_TEST_EQ(val, return_val);
 }
 
+template <typename T>
+std::string stream_string(const T val, const std::ios_base::fmtflags flags, const std::streamsize width = 0, const char fill = ' ')
+{
+    std::stringstream out;
+    out.flags(flags);
+    out << std::setw(static_cast<int>(width)) << std::setfill(fill) << val << '|' << val;
+    return out.str();
+}
+
+// Compares against the builtin types, which the flags are meant to mimic
+void test_formatting_flags()
+{
+    using boost::int128::uint128_t;
+    using boost::int128::int128_t;
+
+    const std::ios_base::fmtflags flag_sets[] {
+        std::ios_base::dec,
+        std::ios_base::hex,
+        std::ios_base::oct,
+        std::ios_base::dec | std::ios_base::showpos,
+        std::ios_base::hex | std::ios_base::showbase,
+        std::ios_base::hex | std::ios_base::showbase | std::ios_base::uppercase,
+        std::ios_base::oct | std::ios_base::showbase,
+        std::ios_base::dec | std::ios_base::left,
+        std::ios_base::dec | std::ios_base::right,
+        std::ios_base::dec | std::ios_base::internal | std::ios_base::showpos,
+        std::ios_base::hex | std::ios_base::internal | std::ios_base::showbase,
+        std::ios_base::hex | std::ios_base::left | std::ios_base::showbase,
+    };
+
+    for (const auto flags : flag_sets)
+    {
+        for (const auto width : {0, 1, 5, 30})
+        {
+            for (const std::uint64_t value : {UINT64_C(0), UINT64_C(1), UINT64_C(42), UINT64_C(0xDEADBEEF), UINT64_MAX})
+            {
+                BOOST_TEST_EQ(stream_string(uint128_t{value}, flags, width, '*'), stream_string(value, flags, width, '*'));
+            }
+
+            for (const std::int64_t value : {INT64_C(0), INT64_C(7), INT64_C(-7), INT64_C(-123456789), INT64_MAX})
+            {
+                // The builtin types write negative values in two's complement for hex and oct
+                if (value < 0 && (flags & std::ios_base::basefield) != std::ios_base::dec)
+                {
+                    continue;
+                }
+
+                BOOST_TEST_EQ(stream_string(int128_t{value}, flags, width, '*'), stream_string(value, flags, width, '*'));
+            }
+        }
+    }
+
+    // Negative values keep their sign in every base
+    BOOST_TEST_EQ(stream_string(int128_t{-255}, std::ios_base::hex | std::ios_base::showbase | std::ios_base::internal, 8, '0'), "-0x000ff|-0xff");
+    BOOST_TEST_EQ(stream_string((std::numeric_limits<int128_t>::min)(), std::ios_base::dec | std::ios_base::right, 42, '_'),
+                  "__-170141183460469231731687303715884105728|-170141183460469231731687303715884105728");
+}
+
+void test_stream_state()
+{
+    using boost::int128::uint128_t;
+    using boost::int128::int128_t;
+
+    // Consecutive values, stopping at the first character that is not a digit
+    std::stringstream values;
+    values.str("  12\n-34 0x1f 0017 99x");
+    int128_t a {};
+    int128_t b {};
+    values >> a >> b;
+    BOOST_TEST_EQ(a, 12);
+    BOOST_TEST_EQ(b, -34);
+
+    // Without a base the prefix decides it, as for the builtin types
+    uint128_t c {};
+    uint128_t d {};
+    uint128_t e {};
+    values.unsetf(std::ios_base::basefield);
+    values >> c >> d >> e;
+    BOOST_TEST_EQ(c, 0x1fU);
+    BOOST_TEST_EQ(d, 017U);
+    BOOST_TEST_EQ(e, 99U);
+    BOOST_TEST(values.good());
+    BOOST_TEST_EQ(values.get(), 'x');
+
+    // Reaching the end of the input sets eofbit along with the value
+    std::stringstream at_end;
+    at_end.str("42");
+    uint128_t f {};
+    at_end >> f;
+    BOOST_TEST_EQ(f, 42U);
+    BOOST_TEST(at_end.eof());
+    BOOST_TEST(!at_end.fail());
+
+    // Out of range values set failbit and leave the value alone
+    const char* const out_of_range[] {
+        "340282366920938463463374607431768211456",
+        "1000000000000000000000000000000000000000000000000000",
+    };
+    for (const auto str : out_of_range)
+    {
+        std::stringstream in;
+        in.str(str);
+        uint128_t val {5};
+        in >> val;
+        BOOST_TEST(in.fail());
+        BOOST_TEST_EQ(val, 5U);
+    }
+
+    std::stringstream max_unsigned;
+    max_unsigned.str("340282366920938463463374607431768211455 0x100000000000000000000000000000000");
+    uint128_t g {};
+    max_unsigned >> g;
+    BOOST_TEST_EQ(g, (std::numeric_limits<uint128_t>::max)());
+    max_unsigned >> std::hex >> g;
+    BOOST_TEST(max_unsigned.fail());
+
+    const char* const signed_limits[] {"170141183460469231731687303715884105728", "-170141183460469231731687303715884105729"};
+    for (const auto str : signed_limits)
+    {
+        std::stringstream in;
+        in.str(str);
+        int128_t val {5};
+        in >> val;
+        BOOST_TEST(in.fail());
+        BOOST_TEST_EQ(val, 5);
+    }
+
+    std::stringstream min_signed;
+    min_signed.str("-170141183460469231731687303715884105728");
+    int128_t h {};
+    min_signed >> h;
+    BOOST_TEST_EQ(h, (std::numeric_limits<int128_t>::min)());
+
+    // No digits after the prefix
+    std::stringstream bad_prefix;
+    bad_prefix.str("0xg");
+    bad_prefix.flags(std::ios_base::hex);
+    uint128_t i {};
+    bad_prefix >> i;
+    BOOST_TEST(bad_prefix.fail());
+
+    // Leading whitespace is only skipped with skipws
+    std::stringstream no_skip;
+    no_skip.str(" 1");
+    no_skip >> std::noskipws;
+    uint128_t j {};
+    no_skip >> j;
+    BOOST_TEST(no_skip.fail());
+
+    // A failed stream is not read from
+    std::stringstream failed;
+    failed.str("42");
+    failed.setstate(std::ios_base::failbit);
+    uint128_t k {};
+    failed >> k;
+    BOOST_TEST_EQ(k, 0U);
+}
+
+void test_wide_stream()
+{
+    using boost::int128::uint128_t;
+    using boost::int128::int128_t;
+
+    std::wstringstream out;
+    out << std::setw(8) << std::left << std::setfill(L' ') << int128_t{-42} << L' '
+        << std::hex << std::showbase << std::uppercase << (std::numeric_limits<uint128_t>::max)();
+    BOOST_TEST(out.str() == L"-42      0XFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+
+    int128_t a {};
+    uint128_t b {};
+    out >> std::dec >> a >> std::hex >> b;
+    BOOST_TEST_EQ(a, -42);
+    BOOST_TEST_EQ(b, (std::numeric_limits<uint128_t>::max)());
+}
+
 #if defined(_MSC_VER)
 #  pragma warning(pop)
 #endif
@@ -298,6 +486,12 @@ int main()
     #endif
 
     test_error_values();
+    test_stream_state();
+
+    #ifndef _M_IX86
+    test_formatting_flags();
+    test_wide_stream();
+    #endif
 
     return boost::report_errors();
 }
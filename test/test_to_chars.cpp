@@ -0,0 +1,170 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/int128.hpp>
+#include <boost/int128/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <limits>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+using namespace boost::int128;
+
+static std::mt19937_64 rng {42};
+
+constexpr std::size_t N {1024};
+
+// One digit per division
+std::string reference_to_chars(uint128_t value, const unsigned base)
+{
+    std::string result;
+    do
+    {
+        const auto digit {static_cast<unsigned>(value % base)};
+        result.push_back(static_cast<char>(digit < 10U ? '0' + digit : 'a' + digit - 10U));
+        value /= base;
+    } while (value != 0U);
+
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+std::string reference_to_chars(const int128_t value, const unsigned base)
+{
+    if (value < 0)
+    {
+        return "-" + reference_to_chars(uint128_t{0} - static_cast<uint128_t>(value), base);
+    }
+
+    return reference_to_chars(static_cast<uint128_t>(value), base);
+}
+
+uint128_t random_u128()
+{
+    return uint128_t{rng(), rng()} >> static_cast<int>(rng() % 128U);
+}
+
+template <typename T>
+void check(const T value, const int base)
+{
+    const auto expected {reference_to_chars(value, static_cast<unsigned>(base))};
+
+    char buffer[160] {};
+    const auto r {to_chars(buffer, buffer + sizeof(buffer), value, base)};
+    BOOST_TEST(r.ec == std::errc{});
+    BOOST_TEST(static_cast<bool>(r));
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), expected);
+
+    // An exact size buffer is enough, and one character less is not
+    const auto exact {buffer + expected.size()};
+    BOOST_TEST(to_chars(buffer, exact, value, base) == (to_chars_result{exact, std::errc{}}));
+
+    const auto short_last {buffer + expected.size() - 1U};
+    const auto too_small {to_chars(buffer, short_last, value, base)};
+    BOOST_TEST(too_small.ec == std::errc::value_too_large);
+    BOOST_TEST(too_small.ptr == short_last);
+}
+
+void test_unsigned()
+{
+    for (int base {2}; base <= 36; ++base)
+    {
+        check(uint128_t{0}, base);
+        check(uint128_t{1}, base);
+        check((std::numeric_limits<uint128_t>::max)(), base);
+        check(uint128_t{UINT64_MAX}, base);
+        check(uint128_t{1} << 64, base);
+
+        for (std::size_t i {}; i < N; ++i)
+        {
+            check(random_u128(), base);
+        }
+    }
+
+    // Every power of the base and its neighbours cover every digit count and each chunk boundary
+    for (int base {2}; base <= 36; ++base)
+    {
+        const auto unsigned_base {static_cast<unsigned>(base)};
+        for (uint128_t power {1}; ; power *= unsigned_base)
+        {
+            check(power, base);
+            check(power - 1U, base);
+            check(power + 1U, base);
+
+            if (power > (std::numeric_limits<uint128_t>::max)() / unsigned_base)
+            {
+                break;
+            }
+        }
+    }
+
+    char buffer[64] {};
+    const auto r {to_chars(buffer, buffer + sizeof(buffer), (std::numeric_limits<uint128_t>::max)())};
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "340282366920938463463374607431768211455");
+}
+
+void test_signed()
+{
+    for (int base {2}; base <= 36; ++base)
+    {
+        check((std::numeric_limits<int128_t>::min)(), base);
+        check((std::numeric_limits<int128_t>::max)(), base);
+        check(int128_t{-1}, base);
+        check(int128_t{0}, base);
+
+        for (std::size_t i {}; i < N; ++i)
+        {
+            const auto value {static_cast<int128_t>(random_u128())};
+            check((rng() & 1U) ? -value : value, base);
+        }
+    }
+
+    char buffer[64] {};
+    const auto r {to_chars(buffer, buffer + sizeof(buffer), (std::numeric_limits<int128_t>::min)())};
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-170141183460469231731687303715884105728");
+
+    // Not even room for the sign
+    BOOST_TEST(to_chars(buffer, buffer, int128_t{-1}).ec == std::errc::value_too_large);
+}
+
+constexpr bool constexpr_to_chars()
+{
+    char buffer[64] {};
+    const auto r {to_chars(buffer, buffer + sizeof(buffer), uint128_t{UINT64_C(1234567890123456789)} * 1000U + 42U)};
+    const char expected[] {"1234567890123456789042"};
+
+    for (std::size_t i {}; i < sizeof(expected) - 1U; ++i)
+    {
+        if (buffer[i] != expected[i])
+        {
+            return false;
+        }
+    }
+
+    if (r.ptr != buffer + sizeof(expected) - 1U)
+    {
+        return false;
+    }
+
+    // Base 36 takes the chunked path, and "zz" is 36^2 - 1
+    const auto r36 {to_chars(buffer, buffer + sizeof(buffer), int128_t{-1295}, 36)};
+    return r36.ptr == buffer + 3 && buffer[0] == '-' && buffer[1] == 'z' && buffer[2] == 'z';
+}
+
+void test_constexpr()
+{
+    static_assert(constexpr_to_chars(), "Wrong");
+}
+
+int main()
+{
+    test_unsigned();
+    test_signed();
+    test_constexpr();
+
+    return boost::report_errors();
+}